@@ -0,0 +1,206 @@
+/**
+ * @file bench_mc.cpp
+ * @brief Benchmark des moteurs Monte Carlo (débit en trajectoires/s, passage à l'échelle en threads).
+ *
+ * Mesure priceMC, chaque grecque (deltaMC ... vegaMC), riskMC et priceMC_BrownianBridge_Asymptotic
+ * sur une grille steps x paths x antithétiques x threads, et écrit les résultats en JSON
+ * pour comparer deux commits.
+ *
+ * Build (Linux) : cible bench_mc du CMakeLists.txt, ou sans CMake :
+ *   g++ -O3 -std=c++14 -pthread -Isrc bench/bench_mc.cpp src/Option.cpp src/Payoff.cpp \
+ *       src/Sobol.cpp src/BrownianBridge.cpp src/Analytic.cpp -o bench_mc
+ *
+ * Usage :
+ *   bench_mc [--out fichier.json] [--steps 50,252] [--paths 10000,40000] [--threads 0,1,4]
+ *            [--reps 3] [--label texte] [--quick]
+ *
+ * Chaque point est exécuté reps fois ; seconds est le meilleur temps, median_seconds la médiane.
+ * paths_per_sec = paths / seconds (une paire antithétique compte pour deux trajectoires).
+ */
+
+#include "Asian.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    using LookbackCall = opt::Asian<opt::FloatingCallPayoff, opt::LookMin>;
+
+    struct Settings {
+        std::vector<int> steps{ 50, 252 };
+        std::vector<int> paths{ 10000, 40000 };
+        std::vector<int> threads;
+        int reps = 3;
+        std::string out = "bench_mc.json";
+        std::string label;
+    };
+
+    struct Result {
+        std::string bench;
+        int steps;
+        int paths;
+        bool antithetic;
+        int threads;
+        double seconds;
+        double medianSeconds;
+        double estimate;
+    };
+
+    std::vector<int> parseList(const char* text) {
+        std::vector<int> values;
+        std::string s(text);
+        std::size_t pos = 0;
+        while (pos < s.size()) {
+            std::size_t comma = s.find(',', pos);
+            if (comma == std::string::npos) comma = s.size();
+            values.push_back(std::atoi(s.substr(pos, comma - pos).c_str()));
+            pos = comma + 1;
+        }
+        return values;
+    }
+
+    /// Meilleur temps et médiane sur reps exécutions ; estimate = dernière valeur renvoyée.
+    Result measure(const std::string& bench, int steps, int paths, bool antithetic, int threads, int reps,
+        const std::function<double()>& run) {
+        std::vector<double> times;
+        double estimate = 0.0;
+        for (int r = 0; r < reps; ++r) {
+            auto start = std::chrono::steady_clock::now();
+            estimate = run();
+            times.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        std::sort(times.begin(), times.end());
+        return Result{ bench, steps, paths, antithetic, threads, times.front(), times[times.size() / 2], estimate };
+    }
+
+    std::string jsonEscape(const std::string& s) {
+        std::string r;
+        for (char c : s) {
+            if (c == '"' || c == '\\') r += '\\';
+            r += c;
+        }
+        return r;
+    }
+
+    void writeJson(const Settings& settings, const std::vector<Result>& results) {
+        std::FILE* f = std::fopen(settings.out.c_str(), "w");
+        if (f == nullptr) {
+            std::fprintf(stderr, "Impossible d'écrire %s\n", settings.out.c_str());
+            std::exit(1);
+        }
+
+        std::fprintf(f, "{\n  \"meta\": {\n");
+        std::fprintf(f, "    \"label\": \"%s\",\n", jsonEscape(settings.label).c_str());
+        std::fprintf(f, "    \"timestamp\": %lld,\n", static_cast<long long>(std::time(nullptr)));
+        std::fprintf(f, "    \"hardware_concurrency\": %u,\n", std::thread::hardware_concurrency());
+#if defined(__clang__)
+        std::fprintf(f, "    \"compiler\": \"clang %s\",\n", __clang_version__);
+#elif defined(__GNUC__)
+        std::fprintf(f, "    \"compiler\": \"gcc %s\",\n", __VERSION__);
+#elif defined(_MSC_VER)
+        std::fprintf(f, "    \"compiler\": \"msvc %d\",\n", _MSC_VER);
+#else
+        std::fprintf(f, "    \"compiler\": \"unknown\",\n");
+#endif
+        std::fprintf(f, "    \"reps\": %d\n  },\n  \"results\": [\n", settings.reps);
+
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            const Result& r = results[i];
+            std::fprintf(f, "    {\"bench\": \"%s\", \"steps\": %d, \"paths\": %d, \"antithetic\": %s, "
+                "\"threads\": %d, \"seconds\": %.6f, \"median_seconds\": %.6f, \"paths_per_sec\": %.1f, "
+                "\"estimate\": %.10g}%s\n",
+                r.bench.c_str(), r.steps, r.paths, r.antithetic ? "true" : "false", r.threads,
+                r.seconds, r.medianSeconds, r.paths / r.seconds, r.estimate,
+                (i + 1 < results.size()) ? "," : "");
+        }
+        std::fprintf(f, "  ]\n}\n");
+        std::fclose(f);
+    }
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    Settings settings;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--out" && hasValue) settings.out = argv[++i];
+        else if (arg == "--steps" && hasValue) settings.steps = parseList(argv[++i]);
+        else if (arg == "--paths" && hasValue) settings.paths = parseList(argv[++i]);
+        else if (arg == "--threads" && hasValue) settings.threads = parseList(argv[++i]);
+        else if (arg == "--reps" && hasValue) settings.reps = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--label" && hasValue) settings.label = argv[++i];
+        else if (arg == "--quick") {
+            settings.steps = { 50 };
+            settings.paths = { 2000 };
+            settings.reps = 1;
+        }
+        else {
+            std::fprintf(stderr, "Argument inconnu : %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    // Threads par défaut : séquentiel historique, 1, puis puissances de 2 jusqu'au nombre de cœurs
+    if (settings.threads.empty()) {
+        const int hw = std::max(1u, std::thread::hardware_concurrency());
+        settings.threads = { 0 };
+        for (int t = 1; t <= hw; t *= 2) settings.threads.push_back(t);
+        if (settings.threads.back() != hw) settings.threads.push_back(hw);
+    }
+
+    const std::uint64_t seed = 42;
+    std::vector<Result> results;
+
+    for (int steps : settings.steps) {
+        for (int paths : settings.paths) {
+            for (int anti = 0; anti <= 1; ++anti) {
+                for (int threads : settings.threads) {
+                    opt::MCConfig config;
+                    config.threads = threads;
+                    LookbackCall option(100.0, 0.03, 0.25, 0.0, 1.0, opt::FloatingCallPayoff(), opt::LookMin());
+                    option.setConfig(config);
+                    const bool a = (anti != 0);
+
+                    const std::vector<std::pair<std::string, std::function<double()>>> benches = {
+                        { "priceMC", [&] { return option.priceMC(paths, steps, seed, a).estimate; } },
+                        { "deltaMC", [&] { return option.deltaMC(paths, steps, seed, a).estimate; } },
+                        { "gammaMC", [&] { return option.gammaMC(paths, steps, seed, a).estimate; } },
+                        { "thetaMC", [&] { return option.thetaMC(paths, steps, seed, a).estimate; } },
+                        { "rhoMC", [&] { return option.rhoMC(paths, steps, seed, a).estimate; } },
+                        { "vegaMC", [&] { return option.vegaMC(paths, steps, seed, a).estimate; } },
+                        { "riskMC", [&] { return option.riskMC(paths, steps, seed, a).price.estimate; } }
+                    };
+
+                    for (const auto& b : benches) {
+                        results.push_back(measure(b.first, steps, paths, a, threads, settings.reps, b.second));
+                        const Result& r = results.back();
+                        std::printf("%-8s steps=%4d paths=%7d anti=%d threads=%2d  %9.4fs  %12.0f paths/s\n",
+                            r.bench.c_str(), steps, paths, anti, threads, r.seconds, r.paths / r.seconds);
+                    }
+                }
+            }
+        }
+    }
+
+    // Référence asymptotique : paramètres fixes internes (1 000 trajectoires x 1 000 pas, antithétiques)
+    {
+        LookbackCall option(100.0, 0.03, 0.25, 0.0, 1.0, opt::FloatingCallPayoff(), opt::LookMin());
+        results.push_back(measure("priceMC_BrownianBridge_Asymptotic", 1000, 1000, true, 0, settings.reps,
+            [&] { return option.priceMC_BrownianBridge_Asymptotic(); }));
+        std::printf("%-8s %9.4fs\n", "bbAsymptotic", results.back().seconds);
+    }
+
+    writeJson(settings, results);
+    std::printf("Résultats : %s\n", settings.out.c_str());
+    return 0;
+}
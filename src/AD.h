@@ -0,0 +1,280 @@
+#ifndef AD_H
+#define AD_H
+
+#include <cmath>
+#include <vector>
+
+namespace opt {
+
+    /**
+     * @brief Nombre dual à N directions (différentiation automatique en mode direct).
+     *
+     * v est la valeur, d[k] la dérivée par rapport au k-ième paramètre d'entrée.
+     * Les comparaisons portent sur la valeur : min/max et payoffs sont dérivés
+     * selon la branche active (dérivée presque sûre).
+     */
+    template <int N>
+    struct Dual {
+        double v;      ///< Valeur.
+        double d[N];   ///< Dérivées partielles.
+
+        Dual(double value = 0.0) : v(value) {
+            for (int k = 0; k < N; ++k) d[k] = 0.0;
+        }
+
+        /**
+         * @brief Variable d'entrée : dérivée 1 dans la direction @p k.
+         */
+        static Dual variable(double value, int k) {
+            Dual x(value);
+            x.d[k] = 1.0;
+            return x;
+        }
+    };
+
+    // ---- Arithmétique ----------------------------------------------------------
+
+    template <int N> inline Dual<N> operator-(const Dual<N>& a) {
+        Dual<N> r(-a.v);
+        for (int k = 0; k < N; ++k) r.d[k] = -a.d[k];
+        return r;
+    }
+
+    template <int N> inline Dual<N> operator+(const Dual<N>& a, const Dual<N>& b) {
+        Dual<N> r(a.v + b.v);
+        for (int k = 0; k < N; ++k) r.d[k] = a.d[k] + b.d[k];
+        return r;
+    }
+
+    template <int N> inline Dual<N> operator-(const Dual<N>& a, const Dual<N>& b) {
+        Dual<N> r(a.v - b.v);
+        for (int k = 0; k < N; ++k) r.d[k] = a.d[k] - b.d[k];
+        return r;
+    }
+
+    template <int N> inline Dual<N> operator*(const Dual<N>& a, const Dual<N>& b) {
+        Dual<N> r(a.v * b.v);
+        for (int k = 0; k < N; ++k) r.d[k] = a.d[k] * b.v + a.v * b.d[k];
+        return r;
+    }
+
+    template <int N> inline Dual<N> operator/(const Dual<N>& a, const Dual<N>& b) {
+        Dual<N> r(a.v / b.v);
+        for (int k = 0; k < N; ++k) r.d[k] = (a.d[k] - r.v * b.d[k]) / b.v;
+        return r;
+    }
+
+    template <int N> inline Dual<N> operator+(const Dual<N>& a, double b) { return a + Dual<N>(b); }
+    template <int N> inline Dual<N> operator+(double a, const Dual<N>& b) { return Dual<N>(a) + b; }
+    template <int N> inline Dual<N> operator-(const Dual<N>& a, double b) { return a - Dual<N>(b); }
+    template <int N> inline Dual<N> operator-(double a, const Dual<N>& b) { return Dual<N>(a) - b; }
+    template <int N> inline Dual<N> operator/(const Dual<N>& a, double b) { return a / Dual<N>(b); }
+    template <int N> inline Dual<N> operator/(double a, const Dual<N>& b) { return Dual<N>(a) / b; }
+
+    template <int N> inline Dual<N> operator*(const Dual<N>& a, double b) {
+        Dual<N> r(a.v * b);
+        for (int k = 0; k < N; ++k) r.d[k] = a.d[k] * b;
+        return r;
+    }
+
+    template <int N> inline Dual<N> operator*(double a, const Dual<N>& b) { return b * a; }
+
+    // ---- Comparaisons (sur la valeur) ------------------------------------------
+
+    template <int N> inline bool operator<(const Dual<N>& a, const Dual<N>& b) { return a.v < b.v; }
+    template <int N> inline bool operator>(const Dual<N>& a, const Dual<N>& b) { return a.v > b.v; }
+    template <int N> inline bool operator<(const Dual<N>& a, double b) { return a.v < b; }
+    template <int N> inline bool operator>(const Dual<N>& a, double b) { return a.v > b; }
+
+    // ---- Fonctions élémentaires ------------------------------------------------
+
+    template <int N> inline Dual<N> exp(const Dual<N>& a) {
+        Dual<N> r(std::exp(a.v));
+        for (int k = 0; k < N; ++k) r.d[k] = r.v * a.d[k];
+        return r;
+    }
+
+    template <int N> inline Dual<N> log(const Dual<N>& a) {
+        Dual<N> r(std::log(a.v));
+        for (int k = 0; k < N; ++k) r.d[k] = a.d[k] / a.v;
+        return r;
+    }
+
+    template <int N> inline Dual<N> sqrt(const Dual<N>& a) {
+        Dual<N> r(std::sqrt(a.v));
+        for (int k = 0; k < N; ++k) r.d[k] = 0.5 * a.d[k] / r.v;
+        return r;
+    }
+
+    template <int N> inline Dual<N> pow(const Dual<N>& a, double p) {
+        Dual<N> r(std::pow(a.v, p));
+        double dp = p * std::pow(a.v, p - 1.0);
+        for (int k = 0; k < N; ++k) r.d[k] = dp * a.d[k];
+        return r;
+    }
+
+    /**
+     * @brief Valeur d'un scalaire générique (double ou Dual), pour les branchements.
+     */
+    inline double valueOf(double x) { return x; }
+
+    template <int N> inline double valueOf(const Dual<N>& a) { return a.v; }
+
+    /**
+     * @brief Fonction de répartition de la loi normale centrée réduite.
+     */
+    inline double normalCdf(double x) {
+        return 0.5 * std::erfc(-x * 0.70710678118654752440);
+    }
+
+    template <int N> inline Dual<N> normalCdf(const Dual<N>& a) {
+        Dual<N> r(normalCdf(a.v));
+        double density = 0.39894228040143267794 * std::exp(-0.5 * a.v * a.v);
+        for (int k = 0; k < N; ++k) r.d[k] = density * a.d[k];
+        return r;
+    }
+
+    // ============================================================================
+    //  Mode adjoint (AAD) : enregistrement sur bande et balayage arrière
+    // ============================================================================
+
+    /**
+     * @brief Bande (tape) d'enregistrement des opérations pour la différentiation adjointe.
+     *
+     * Chaque opération sur AReal ajoute un nœud (au plus deux arguments, avec les dérivées
+     * partielles locales). Un balayage arrière depuis la sortie accumule les adjoints,
+     * donc toutes les sensibilités, pour un coût proportionnel à la taille de la bande.
+     * Une bande par thread (Tape::local) ; clear() conserve la mémoire allouée.
+     */
+    class Tape {
+    public:
+        struct Node {
+            int arg[2];        ///< Indices des arguments (-1 : aucun).
+            double partial[2]; ///< Dérivées partielles locales.
+        };
+
+        /**
+         * @brief Bande du thread courant.
+         */
+        static Tape& local() {
+            static thread_local Tape tape;
+            return tape;
+        }
+
+        /**
+         * @brief Ajoute un nœud et renvoie son indice.
+         */
+        int push(int a, double da, int b, double db) {
+            Node n;
+            n.arg[0] = a; n.partial[0] = da;
+            n.arg[1] = b; n.partial[1] = db;
+            nodes_.push_back(n);
+            return static_cast<int>(nodes_.size()) - 1;
+        }
+
+        /**
+         * @brief Vide la bande (la capacité est conservée : pas de réallocation en régime établi).
+         */
+        void clear() { nodes_.clear(); }
+
+        /**
+         * @brief Balayage arrière depuis le nœud @p output (adjoint initial 1).
+         */
+        void propagate(int output) {
+            adjoints_.assign(nodes_.size(), 0.0);
+            if (output < 0) return;
+            adjoints_[output] = 1.0;
+            for (int i = output; i >= 0; --i) {
+                double a = adjoints_[i];
+                if (a == 0.0) continue;
+                const Node& n = nodes_[i];
+                if (n.arg[0] >= 0) adjoints_[n.arg[0]] += n.partial[0] * a;
+                if (n.arg[1] >= 0) adjoints_[n.arg[1]] += n.partial[1] * a;
+            }
+        }
+
+        /**
+         * @brief Adjoint du nœud @p idx après propagate (0 pour une constante).
+         */
+        double adjoint(int idx) const { return (idx >= 0) ? adjoints_[idx] : 0.0; }
+
+    private:
+        std::vector<Node> nodes_;
+        std::vector<double> adjoints_;
+    };
+
+    /**
+     * @brief Réel actif enregistré sur la bande du thread courant (idx = -1 : constante).
+     */
+    struct AReal {
+        double v;  ///< Valeur.
+        int idx;   ///< Indice du nœud sur la bande.
+
+        AReal(double value = 0.0) : v(value), idx(-1) {}
+
+        /**
+         * @brief Variable d'entrée (feuille de la bande).
+         */
+        static AReal variable(double value) {
+            AReal x(value);
+            x.idx = Tape::local().push(-1, 0.0, -1, 0.0);
+            return x;
+        }
+    };
+
+    /**
+     * @brief Crée le résultat d'une opération (pas de nœud si tous les arguments sont constants).
+     */
+    inline AReal recordNode(double value, int a, double da, int b = -1, double db = 0.0) {
+        AReal r(value);
+        if (a >= 0 || b >= 0) r.idx = Tape::local().push(a, da, b, db);
+        return r;
+    }
+
+    inline AReal operator-(const AReal& a) { return recordNode(-a.v, a.idx, -1.0); }
+    inline AReal operator+(const AReal& a, const AReal& b) { return recordNode(a.v + b.v, a.idx, 1.0, b.idx, 1.0); }
+    inline AReal operator-(const AReal& a, const AReal& b) { return recordNode(a.v - b.v, a.idx, 1.0, b.idx, -1.0); }
+    inline AReal operator*(const AReal& a, const AReal& b) { return recordNode(a.v * b.v, a.idx, b.v, b.idx, a.v); }
+
+    inline AReal operator/(const AReal& a, const AReal& b) {
+        double r = a.v / b.v;
+        return recordNode(r, a.idx, 1.0 / b.v, b.idx, -r / b.v);
+    }
+
+    inline AReal operator+(const AReal& a, double b) { return recordNode(a.v + b, a.idx, 1.0); }
+    inline AReal operator+(double a, const AReal& b) { return recordNode(a + b.v, b.idx, 1.0); }
+    inline AReal operator-(const AReal& a, double b) { return recordNode(a.v - b, a.idx, 1.0); }
+    inline AReal operator-(double a, const AReal& b) { return recordNode(a - b.v, b.idx, -1.0); }
+    inline AReal operator*(const AReal& a, double b) { return recordNode(a.v * b, a.idx, b); }
+    inline AReal operator*(double a, const AReal& b) { return recordNode(a * b.v, b.idx, a); }
+    inline AReal operator/(const AReal& a, double b) { return recordNode(a.v / b, a.idx, 1.0 / b); }
+
+    inline AReal operator/(double a, const AReal& b) {
+        double r = a / b.v;
+        return recordNode(r, b.idx, -r / b.v);
+    }
+
+    inline bool operator<(const AReal& a, const AReal& b) { return a.v < b.v; }
+    inline bool operator>(const AReal& a, const AReal& b) { return a.v > b.v; }
+    inline bool operator<(const AReal& a, double b) { return a.v < b; }
+    inline bool operator>(const AReal& a, double b) { return a.v > b; }
+
+    inline AReal exp(const AReal& a) {
+        double r = std::exp(a.v);
+        return recordNode(r, a.idx, r);
+    }
+
+    inline AReal log(const AReal& a) { return recordNode(std::log(a.v), a.idx, 1.0 / a.v); }
+
+    inline AReal sqrt(const AReal& a) {
+        double r = std::sqrt(a.v);
+        return recordNode(r, a.idx, 0.5 / r);
+    }
+
+    inline AReal pow(const AReal& a, double p) {
+        return recordNode(std::pow(a.v, p), a.idx, p * std::pow(a.v, p - 1.0));
+    }
+
+} // namespace opt
+
+#endif // AD_H
@@ -3,11 +3,23 @@
 
 #include <cmath>
 #include <stdexcept>
+#include <type_traits>
 
 namespace opt {
 
 	/**
 	 * @brief Interface abstraite pour l'agrégation des prix path-dépendants.
+	 *
+	 * Les agrégateurs concrets exposent aussi apply<T>(agg, price, step), même calcul
+	 * sur un type numérique générique (double ou type dérivable, cf. AD.h), utilisé
+	 * par les estimateurs pathwise des grecques.
+	 *
+	 * Protocole en flux : l'état courant est distinct de la valeur agrégée.
+	 *  - init(S0)                 : état initial (trajectoire en S0) ;
+	 *  - accumulate(state, price) : une addition ou une comparaison par pas ;
+	 *  - finalize(state, steps)   : valeur agrégée à maturité (steps + 1 observations).
+	 * Les traits ci-dessous (is_monotone_extreme, is_log_additive, ...) permettent aux moteurs
+	 * de choisir un schéma spécialisé à la compilation.
 	 */
 	class Aggregator {
 	public:
@@ -29,6 +41,21 @@ namespace opt {
 		double operator()(double agg, double price, double step) const override {
 			return (agg * step + price) / (step + 1);
 		}
+
+		template <typename T>
+		T apply(const T& agg, const T& price, double step) const {
+			return (agg * step + price) / (step + 1);
+		}
+
+		/// État : somme courante des prix.
+		template <typename T>
+		T init(const T& S0) const { return S0; }
+
+		template <typename T>
+		T accumulate(const T& sum, const T& price) const { return sum + price; }
+
+		template <typename T>
+		T finalize(const T& sum, int steps) const { return sum / static_cast<double>(steps + 1); }
 	};
 
 	/**
@@ -36,8 +63,35 @@ namespace opt {
 	 */
 	class Geometric : public Aggregator {
 	public:
+		// En log : pow(agg, step) déborde sur les grilles longues
 		double operator()(double agg, double price, double step) const override {
-			return std::pow(std::pow(agg, step) * price, 1.0 / (step + 1));
+			return std::exp((step * std::log(agg) + std::log(price)) / (step + 1));
+		}
+
+		template <typename T>
+		T apply(const T& agg, const T& price, double step) const {
+			using std::exp;
+			using std::log;
+			return exp((step * log(agg) + log(price)) / (step + 1));
+		}
+
+		/// État : somme courante des log-prix.
+		template <typename T>
+		T init(const T& S0) const {
+			using std::log;
+			return log(S0);
+		}
+
+		template <typename T>
+		T accumulate(const T& logSum, const T& price) const {
+			using std::log;
+			return logSum + log(price);
+		}
+
+		template <typename T>
+		T finalize(const T& logSum, int steps) const {
+			using std::exp;
+			return exp(logSum / static_cast<double>(steps + 1));
 		}
 	};
 
@@ -49,6 +103,21 @@ namespace opt {
 		double operator()(double agg, double price, double step) const override {
 			return std::max<double>(agg, price);
 		}
+
+		template <typename T>
+		T apply(const T& agg, const T& price, double /*step*/) const {
+			return (agg < price) ? price : agg;
+		}
+
+		/// État : extrême courant.
+		template <typename T>
+		T init(const T& S0) const { return S0; }
+
+		template <typename T>
+		T accumulate(const T& ext, const T& price) const { return (ext < price) ? price : ext; }
+
+		template <typename T>
+		T finalize(const T& ext, int /*steps*/) const { return ext; }
 	};
 
 	/**
@@ -59,8 +128,72 @@ namespace opt {
 		double operator()(double agg, double price, double step) const override {
 			return std::min<double>(agg, price);
 		}
+
+		template <typename T>
+		T apply(const T& agg, const T& price, double /*step*/) const {
+			return (price < agg) ? price : agg;
+		}
+
+		/// État : extrême courant.
+		template <typename T>
+		T init(const T& S0) const { return S0; }
+
+		template <typename T>
+		T accumulate(const T& ext, const T& price) const { return (price < ext) ? price : ext; }
+
+		template <typename T>
+		T finalize(const T& ext, int /*steps*/) const { return ext; }
 	};
 
+	/**
+	 * @brief Trait : l'agrégateur est un extrême courant (min ou max).
+	 *
+	 * Un tel agrégateur commute avec toute fonction croissante : l'extrême des log-prix
+	 * donne le log de l'extrême des prix. Les moteurs peuvent alors faire évoluer la
+	 * trajectoire en log et ne prendre que deux exponentielles par trajectoire.
+	 */
+	template <typename TAggregator>
+	struct is_monotone_extreme : std::false_type {};
+
+	template <>
+	struct is_monotone_extreme<LookMax> : std::true_type {};
+
+	template <>
+	struct is_monotone_extreme<LookMin> : std::true_type {};
+
+	/**
+	 * @brief Trait : sens de l'extrême suivi (+1 : maximum, -1 : minimum, 0 : autre agrégateur).
+	 */
+	template <typename TAggregator>
+	struct extreme_direction : std::integral_constant<int, 0> {};
+
+	template <>
+	struct extreme_direction<LookMax> : std::integral_constant<int, 1> {};
+
+	template <>
+	struct extreme_direction<LookMin> : std::integral_constant<int, -1> {};
+
+	/**
+	 * @brief Trait : l'état en flux est la somme des log-prix (moyenne géométrique).
+	 *
+	 * Un moteur en log-prix x = log(S/S0) accumule directement x (une addition par pas) :
+	 * valeur finale S0 exp(sum x / (steps + 1)), une seule exponentielle par trajectoire.
+	 */
+	template <typename TAggregator>
+	struct is_log_additive : std::false_type {};
+
+	template <>
+	struct is_log_additive<Geometric> : std::true_type {};
+
+	/**
+	 * @brief Trait : l'état en flux est la somme des prix (moyenne arithmétique).
+	 */
+	template <typename TAggregator>
+	struct is_additive : std::false_type {};
+
+	template <>
+	struct is_additive<Arithmetic> : std::true_type {};
+
 } // namespace opt 
 
 #endif // AGGREGATOR_H
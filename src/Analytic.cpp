@@ -0,0 +1,110 @@
+#include "pch.h"
+#include "Analytic.h"
+#include "AD.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace opt {
+
+    namespace {
+
+        /// En deçà, le terme sigma^2 / (2R) est évalué par interpolation (forme 0/0 en R = 0).
+        constexpr double kSmallRate = 1e-3;
+
+        void validateAnalytic(double S0, double R, double sigma, double T0, double T) {
+            if (!(std::isfinite(S0) && std::isfinite(R) && std::isfinite(sigma) && std::isfinite(T0) && std::isfinite(T)))
+                throw std::invalid_argument("Paramètres non finis (NaN/Inf) interdits.");
+            if (!(S0 > 0.0)) throw std::invalid_argument("S0 doit être strictement positif.");
+            if (!(sigma > 0.0)) throw std::invalid_argument("Formule fermée : sigma doit être > 0.");
+            if (!(T > T0)) throw std::invalid_argument("Il faut T > T0 (maturité strictement après T0).");
+        }
+
+        /**
+         * @brief Formule de Goldman–Sosin–Gatto avec extrême courant égal à S (R != 0).
+         *
+         * a1 = (R + sigma^2/2) sqrt(tau) / sigma, a2 = a1 - sigma sqrt(tau) :
+         *  - call : S [N(a1) - e^{-R tau} N(a2) + sigma^2/(2R) (e^{-R tau} N(a2) - N(-a1))]
+         *  - put  : S [e^{-R tau} N(-a2) - N(-a1) + sigma^2/(2R) (N(a1) - e^{-R tau} N(-a2))]
+         */
+        template <typename Num>
+        Num floatingLookback(const Num& S, const Num& R, const Num& sigma, const Num& tau, bool call) {
+            using std::exp;
+            using std::sqrt;
+
+            Num sqrtTau = sqrt(tau);
+            Num a1 = (R + 0.5 * sigma * sigma) * sqrtTau / sigma;
+            Num a2 = a1 - sigma * sqrtTau;
+            Num disc = exp(-R * tau);
+            Num k = sigma * sigma / (2.0 * R);
+
+            if (call)
+                return S * (normalCdf(a1) - disc * normalCdf(a2) + k * (disc * normalCdf(a2) - normalCdf(-a1)));
+            return S * (disc * normalCdf(-a2) - normalCdf(-a1) + k * (normalCdf(a1) - disc * normalCdf(-a2)));
+        }
+
+        /**
+         * @brief Formule fermée valable pour tout R, y compris au voisinage de 0.
+         *
+         * Pour |R| < kSmallRate, interpolation de Lagrange sur les nœuds {-2h, -h, h, 2h}
+         * (h = kSmallRate) : erreur O(h^4), sans la compensation catastrophique du terme
+         * sigma^2/(2R), et dérivée en R continue.
+         */
+        template <typename Num>
+        Num floatingLookbackAnyRate(const Num& S, const Num& R, const Num& sigma, const Num& tau, bool call) {
+            const double r = valueOf(R);
+            if (std::fabs(r) >= kSmallRate) return floatingLookback(S, R, sigma, tau, call);
+
+            const double h = kSmallRate;
+            const double nodes[4] = { -2.0 * h, -h, h, 2.0 * h };
+            Num result(0.0);
+
+            for (int i = 0; i < 4; ++i) {
+                Num weight(1.0);
+                for (int j = 0; j < 4; ++j)
+                    if (j != i) weight = weight * (R - nodes[j]) / (nodes[i] - nodes[j]);
+                result = result + weight * floatingLookback(S, Num(nodes[i]), sigma, tau, call);
+            }
+            return result;
+        }
+
+        double price(double S0, double R, double sigma, double T0, double T, bool call) {
+            validateAnalytic(S0, R, sigma, T0, T);
+            return floatingLookbackAnyRate(S0, R, sigma, T - T0, call);
+        }
+
+        AnalyticRisk risk(double S0, double R, double sigma, double T0, double T, bool call) {
+            validateAnalytic(S0, R, sigma, T0, T);
+
+            using D = Dual<3>;
+            D p = floatingLookbackAnyRate(D(S0), D::variable(R, 0), D::variable(sigma, 1),
+                D::variable(T - T0, 2), call);
+
+            AnalyticRisk out;
+            out.price = p.v;
+            out.delta = p.v / S0;
+            out.gamma = 0.0;
+            out.theta = -p.d[2];   // tau = T - T0
+            out.rho = p.d[0];
+            out.vega = p.d[1];
+            return out;
+        }
+
+    } // namespace
+
+    double lookbackFloatingCallAnalytic(double S0, double R, double sigma, double T0, double T) {
+        return price(S0, R, sigma, T0, T, true);
+    }
+
+    double lookbackFloatingPutAnalytic(double S0, double R, double sigma, double T0, double T) {
+        return price(S0, R, sigma, T0, T, false);
+    }
+
+    AnalyticRisk lookbackFloatingCallRiskAnalytic(double S0, double R, double sigma, double T0, double T) {
+        return risk(S0, R, sigma, T0, T, true);
+    }
+
+    AnalyticRisk lookbackFloatingPutRiskAnalytic(double S0, double R, double sigma, double T0, double T) {
+        return risk(S0, R, sigma, T0, T, false);
+    }
+
+} // namespace opt
@@ -0,0 +1,102 @@
+#ifndef ANALYTIC_H
+#define ANALYTIC_H
+
+#include "Aggregator.h"
+#include "Payoff.h"
+#include <stdexcept>
+
+namespace opt {
+
+    /**
+     * @brief Prix et grecques d'une formule fermée (mêmes conventions que MCRisk).
+     */
+    struct AnalyticRisk {
+        double price = 0.0;  ///< Prix.
+        double delta = 0.0;  ///< dP/dS0.
+        double gamma = 0.0;  ///< d2P/dS0^2.
+        double theta = 0.0;  ///< dP/dT0.
+        double rho = 0.0;    ///< dP/dR.
+        double vega = 0.0;   ///< dP/dsigma.
+    };
+
+    /**
+     * @brief Call lookback à strike flottant, surveillance continue (Goldman, Sosin & Gatto, 1979).
+     *
+     * Payoff S_T - min(S_t, T0 <= t <= T), minimum initialisé à S0 en T0 : même contrat que
+     * l'option Monte Carlo PayoffCall + LookMin, à la limite steps -> infini.
+     * Sert de valeur de référence (étude de convergence, tests de non-régression) et de
+     * variable de contrôle.
+     *
+     * @throw std::invalid_argument si les paramètres sont incohérents ou sigma <= 0.
+     */
+    double lookbackFloatingCallAnalytic(double S0, double R, double sigma, double T0, double T);
+
+    /**
+     * @brief Put lookback à strike flottant, surveillance continue : payoff max(S_t) - S_T.
+     *
+     * @see lookbackFloatingCallAnalytic
+     */
+    double lookbackFloatingPutAnalytic(double S0, double R, double sigma, double T0, double T);
+
+    /**
+     * @brief Prix et grecques exactes du call lookback flottant.
+     *
+     * Les dérivées sont celles de la formule fermée (différentiation automatique en mode
+     * direct, exactes à la précision machine). Le prix étant homogène de degré 1 en S0
+     * (extrême initialisé à S0), delta = P / S0 et gamma = 0.
+     */
+    AnalyticRisk lookbackFloatingCallRiskAnalytic(double S0, double R, double sigma, double T0, double T);
+
+    /**
+     * @brief Prix et grecques exactes du put lookback flottant.
+     *
+     * @see lookbackFloatingCallRiskAnalytic
+     */
+    AnalyticRisk lookbackFloatingPutRiskAnalytic(double S0, double R, double sigma, double T0, double T);
+
+    /**
+     * @brief Formule fermée du contrat Asian<TPayoff, TAggregator> en surveillance continue.
+     *
+     * available vaut true pour les lookbacks à strike flottant (PayoffCall ou
+     * FloatingStrikePayoff<CallPolicy> + LookMin, PayoffPut ou FloatingStrikePayoff<PutPolicy>
+     * + LookMax) ; utilisé comme moyenne exacte de la variable de contrôle
+     * ControlVariate::ContinuousExtreme.
+     */
+    template <typename TPayoff, typename TAggregator>
+    struct ContinuousLookbackPrice {
+        static constexpr bool available = false;
+        static constexpr double extremeSign = 0.0;  ///< -1 : minimum suivi, +1 : maximum suivi.
+        static double value(double, double, double, double, double) {
+            throw std::invalid_argument("Pas de formule fermée pour ce couple payoff / agrégateur.");
+        }
+    };
+
+    template <>
+    struct ContinuousLookbackPrice<PayoffCall, LookMin> {
+        static constexpr bool available = true;
+        static constexpr double extremeSign = -1.0;
+        static double value(double S0, double R, double sigma, double T0, double T) {
+            return lookbackFloatingCallAnalytic(S0, R, sigma, T0, T);
+        }
+    };
+
+    template <>
+    struct ContinuousLookbackPrice<PayoffPut, LookMax> {
+        static constexpr bool available = true;
+        static constexpr double extremeSign = 1.0;
+        static double value(double S0, double R, double sigma, double T0, double T) {
+            return lookbackFloatingPutAnalytic(S0, R, sigma, T0, T);
+        }
+    };
+
+    template <>
+    struct ContinuousLookbackPrice<FloatingStrikePayoff<CallPolicy>, LookMin>
+        : ContinuousLookbackPrice<PayoffCall, LookMin> {};
+
+    template <>
+    struct ContinuousLookbackPrice<FloatingStrikePayoff<PutPolicy>, LookMax>
+        : ContinuousLookbackPrice<PayoffPut, LookMax> {};
+
+} // namespace opt
+
+#endif // ANALYTIC_H
@@ -1,12 +1,198 @@
 #ifndef ASIAN_H
 #define ASIAN_H
 
+#include "AD.h"
+#include "Analytic.h"
+#include "Kernels.h"
 #include "Option.h"
+#include "Parallel.h"
+#include "Random.h"
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <random>
+#include <utility>
 #include <vector>
 
 namespace opt {
 
+    /**
+     * @brief Méthode d'estimation des grecques.
+     */
+    enum class GreekMethod {
+        /// Bump-and-reprice : différences finies centrées (historique).
+        FiniteDifference,
+        /**
+         * Dérivée trajectorielle (IPA) : delta, theta, rho et vega sont obtenus en dérivant
+         * le payoff actualisé de chaque trajectoire (différentiation automatique directe,
+         * une seule valorisation par trajectoire). Les min/max sont dérivables presque
+         * sûrement ; le payoff doit être lipschitzien (TPayoff::isLipschitz).
+         *
+         * Gamma : l'agrégat étant initialisé à S0, S0 intervient de façon déterministe dans
+         * le payoff et n'admet pas de poids de vraisemblance (LR). On utilise l'homogénéité :
+         * tous les agrégateurs sont homogènes de degré 1 en la trajectoire, donc un payoff
+         * de degré k donne P(S0) = S0^k P(1) et gamma = k(k-1) P / S0^2 trajectoire par trajectoire.
+         * Payoff non homogène (strike fixe, homogeneityDegree < 0) : différence centrée des
+         * deltas pathwise (RiskBumps::gammaRelEps).
+         */
+        Pathwise,
+        /**
+         * Différentiation adjointe (AAD) : riskMC enregistre chaque trajectoire sur une bande
+         * (AReal, cf. AD.h) et un seul balayage arrière fournit delta, theta, rho et vega,
+         * pour un coût de l'ordre de 3 à 4 valorisations. Mêmes conditions de validité et
+         * même gamma que Pathwise ; les grecques individuelles (deltaMC, ...) utilisent
+         * le mode direct, moins coûteux pour une seule sensibilité.
+         */
+        Adjoint
+    };
+
+    /**
+     * @brief Variable de contrôle de priceMC (coefficient optimal estimé sur les mêmes trajectoires).
+     */
+    enum class ControlVariate {
+        /// Aucune (estimateur Monte Carlo brut).
+        None,
+        /**
+         * Payoff du même contrat en surveillance continue, d'espérance donnée par la formule
+         * fermée (ContinuousLookbackPrice). L'extrême continu de chaque pas est tiré
+         * conditionnellement aux extrémités (pont brownien), avec steps gaussiennes
+         * supplémentaires par trajectoire. Lookbacks flottants call/min et put/max uniquement.
+         */
+        ContinuousExtreme,
+        /**
+         * Moyenne géométrique actualisée disc * (S_0 S_1 ... S_steps)^(1/(steps+1)),
+         * log-normale donc d'espérance exacte. Tout couple payoff / agrégateur.
+         */
+        GeometricAverage
+    };
+
+    /**
+     * @brief Noyau de simulation des trajectoires.
+     */
+    enum class PathKernel {
+        /// Une trajectoire à la fois (historique).
+        Scalar,
+        /**
+         * kSimdLanes trajectoires en parallèle (SoA), exponentielle vectorisable et
+         * agrégation min/max vectorisée ; variante AVX-512 / AVX2 / scalaire choisie à
+         * l'exécution (cf. Kernels.h). Les tirages sont ceux du moteur scalaire ; seule
+         * l'exponentielle diffère (fastExp, erreur relative de l'ordre de 1e-16).
+         */
+        Batched
+    };
+
+    /**
+     * @brief Paramètres d'exécution du moteur Monte Carlo.
+     *
+     * La configuration par défaut reproduit exactement le moteur historique
+     * (séquentiel, flux mt19937_64 unique).
+     */
+    struct MCConfig {
+        /**
+         * @brief Nombre de threads.
+         *
+         * - 0  : moteur séquentiel historique (un seul flux mt19937_64 pour toutes les trajectoires) ;
+         * - n >= 1 : moteur parallèle. Les trajectoires sont découpées en blocs de taille fixe,
+         *   chaque bloc tire dans son propre sous-flux (graine dérivée de (seed, bloc)) et les
+         *   accumulateurs de Welford des blocs sont fusionnés dans l'ordre des blocs.
+         *   Le résultat est donc identique au bit près quel que soit n.
+         */
+        int threads = 0;
+
+        /// Méthode d'estimation des grecques (deltaMC, ..., riskMC).
+        GreekMethod greeks = GreekMethod::FiniteDifference;
+
+        /// Noyau de simulation des trajectoires utilisé par priceMC.
+        PathKernel kernel = PathKernel::Scalar;
+
+        /**
+         * @brief Schéma spécialisé selon l'agrégateur (protocole en flux, cf. Aggregator.h).
+         *
+         * - is_monotone_extreme : log S avance par incréments (R - sigma^2/2) dt + sigma sqrt(dt) Z
+         *   aux constantes précalculées, l'extrême est suivi en log, et seuls S_T et l'extrême sont
+         *   exponentiés : deux exponentielles par trajectoire au lieu de steps ;
+         * - is_log_additive (géométrique) : somme des log-prix, une addition par pas, deux
+         *   exponentielles par trajectoire ;
+         * - autres (arithmétique) : état en flux (somme) mis à jour par une addition, valeur
+         *   finale calculée une fois à maturité.
+         * Résultats égaux au schéma historique aux arrondis près. S'applique au prix et aux
+         * grecques par différences finies.
+         */
+        bool logSpace = false;
+
+        /**
+         * @brief Générateur des gaussiennes (voir RngKind).
+         *
+         * Avec RngKind::Philox, les gaussiennes de la trajectoire i ne dépendent que de
+         * (seed, i) : les trajectoires simulées sont les mêmes en séquentiel et pour tout
+         * nombre de threads (résultats égaux aux arrondis de la fusion des accumulateurs près).
+         */
+        RngKind rng = RngKind::MersenneTwister;
+
+        /**
+         * @brief Nombre de randomisations indépendantes en quasi-Monte Carlo (RngKind::Sobol, >= 2).
+         *
+         * Les échantillons sont répartis en qmcRandomisations suites de Sobol de même longueur
+         * (arrondie au-dessus), chacune avec son propre décalage digital. L'estimateur est la
+         * moyenne des estimations de chaque suite et l'erreur standard celle de cette moyenne :
+         * MCStats garde le même sens qu'en Monte Carlo. Longueurs en puissances de 2 conseillées.
+         */
+        int qmcRandomisations = 16;
+
+        /**
+         * @brief Variable de contrôle de priceMC (voir ControlVariate).
+         *
+         * Le prix et son erreur standard sont ceux de l'estimateur ajusté. Utilise le moteur
+         * scalaire quel que soit MCConfig::kernel ; les grecques ne sont pas concernées.
+         */
+        ControlVariate control = ControlVariate::None;
+
+        /**
+         * @brief Correction de pont brownien : extrême à surveillance continue (agrégateurs min/max).
+         *
+         * Sur chaque pas, l'extrême du pont entre log S_j et log S_{j+1} est tiré exactement
+         * (x + x' +/- sqrt((x' - x)^2 - 2 sigma^2 dt log U)) / 2, seul le sens utilisé par
+         * l'agrégateur étant simulé. Le prix converge vers celui du lookback continu quel que soit
+         * steps. Chaque trajectoire consomme 2 * steps gaussiennes (la seconde moitié donne les U ;
+         * en RngKind::Sobol, seule la première passe par le pont brownien).
+         * S'applique au prix, aux grecques (toutes méthodes) et aux scénarios ; moteur scalaire
+         * quel que soit MCConfig::kernel ; incompatible avec priceMLMC (cible discrète).
+         */
+        bool bridgeCorrection = false;
+
+        /**
+         * @brief Antithétiques fusionnés : les deux jambes d'une paire avancent dans la même boucle.
+         *
+         * L'incrément miroir est exp(2 (R - sigma^2/2) dt) / exp((R - sigma^2/2) dt + sigma sqrt(dt) Z) :
+         * une exponentielle par pas sert les deux jambes (aucune en log-prix, voir logSpace).
+         * S'applique au prix (moteur scalaire) et aux grecques par différences finies, estimateurs
+         * linéaires en payoffs : mêmes tirages, résultats égaux au moteur non fusionné aux arrondis
+         * près. Sans effet sans antithétiques, avec bridgeCorrection ou les grecques pathwise/adjointes.
+         * Activé par les exports C (variantes _vr, jobs asynchrones), sauf le portefeuille.
+         */
+        bool fusedAntithetic = false;
+    };
+
+    /**
+     * @brief Epsilons des grecques par différences finies (riskMC, riskSample).
+     */
+    struct RiskBumps {
+        double deltaRelEps = 1e-4;         ///< Bump relatif de S0 pour delta.
+        double gammaRelEps = 1e-3;         ///< Bump relatif de S0 pour gamma.
+        double thetaEps = 1.0 / 365.0;     ///< Bump de T0.
+        double rhoEps = 1e-4;              ///< Bump de R.
+        double vegaEps = 1e-4;             ///< Bump de sigma.
+    };
+
+    /**
+     * @brief Point d'une grille de scénarios de marché (scenarioMC).
+     */
+    struct MCScenario {
+        double S0 = 0.0;     ///< Spot.
+        double R = 0.0;      ///< Taux sans risque.
+        double sigma = 0.0;  ///< Volatilité.
+    };
+
     /**
      * @brief Option path-dépendante en Black–Scholes valorisée par Monte Carlo.
      *
@@ -19,13 +205,37 @@ namespace opt {
      *                     double operator()(double agg, double price, double step) const
      *
      * Variance reduction : variables antithétiques (optionnel).
-     * Grecques : bump-and-reprice (différences finies centrées).
+     * Grecques : bump-and-reprice (différences finies centrées) ou pathwise, voir MCConfig::greeks.
+     * Parallélisme : optionnel, voir MCConfig::threads.
      */
     template <typename TPayoff, typename TAggregator>
     class Asian : public Option {
     private:
         TPayoff payoff_;
         TAggregator aggregator_;
+        MCConfig config_;
+
+        /// Nombre d'échantillons par bloc du moteur parallèle (fixe : garantit le déterminisme).
+        static constexpr int kBlockSamples = 4096;
+
+        /// Trajectoires pilotes par niveau de priceMLMC.
+        static constexpr int kMultilevelPilotPaths = 2000;
+
+        /// Trajectoires finales minimales par niveau de priceMLMC (erreur standard estimable).
+        static constexpr int kMultilevelMinPaths = 64;
+
+        /**
+         * @brief Critère d'arrêt du mode adaptatif (priceMCAdaptive).
+         */
+        struct StopRule {
+            double targetSE = 0.0;     ///< Erreur standard visée.
+            double maxSeconds = 0.0;   ///< Budget de temps (0 : aucun).
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            /// Erreur standard de l'estimateur final à partir des accumulateurs courants.
+            std::function<double(const std::vector<MCAccumulator>&)> stdError;
+            std::int64_t samples = 0;  ///< Sortie : échantillons simulés.
+            bool converged = false;    ///< Sortie : erreur cible atteinte.
+        };
 
         /**
          * @brief Simule le payoff actualisé (discounted) pour un vecteur gaussien donné.
@@ -33,6 +243,113 @@ namespace opt {
         double discountedPayoffFromZ(double S0, double R, double sigma, double T0, double T, int steps,
             const std::vector<double>& Zs, bool flip) const;
 
+        /**
+         * @brief Échantillon couplé du niveau MLMC à @p steps pas.
+         *
+         * out[0] = P_fin - P_grossier, out[1] = P_fin. La trajectoire grossière (steps / 2 pas)
+         * utilise les incréments fins sommés deux à deux : (Z[2k] + Z[2k+1]) / sqrt(2).
+         */
+        void multilevelSample(int steps, const std::vector<double>& Zs, bool flip, double* out) const;
+
+        /**
+         * @brief Moyenne des payoffs actualisés des deux jambes antithétiques (Zs et -Zs), en une passe.
+         */
+        double antitheticPayoffFromZ(double S0, double R, double sigma, double T0, double T, int steps,
+            const std::vector<double>& Zs) const;
+
+        /**
+         * @brief Moteur des estimateurs linéaires en payoffs (prix, grecques par différences finies).
+         *
+         * @tparam SampleFn Callable : void(const PayoffAt& P, double* out), où P(S0, R, sigma, T0)
+         *                  renvoie le payoff actualisé de la trajectoire courante sous ces paramètres.
+         *                  Avec MCConfig::fusedAntithetic, P renvoie directement la moyenne de la paire.
+         */
+        template <typename SampleFn>
+        std::vector<MCAccumulator> runPayoffMC(int paths, int steps, std::uint64_t seed, bool antithetic,
+            int outputs, SampleFn&& sampleFn, StopRule* stop = nullptr) const;
+
+        /**
+         * @brief Prix et grecques par différences finies à partir d'un évaluateur P(S0, R, sigma, T0).
+         */
+        template <typename PayoffAt>
+        void riskFromPayoffs(const PayoffAt& P, const RiskBumps& bumps, double* out) const;
+
+        /// Paramètres différentiables en mode pathwise (directions des nombres duaux).
+        enum Param { kS0 = 0, kR = 1, kSigma = 2, kT0 = 3 };
+
+        /**
+         * @brief Payoff actualisé sur un type numérique générique (double ou Dual<N>).
+         *
+         * Même schéma que discountedPayoffFromZ, paramétré par tau = T - T0.
+         */
+        template <typename Num>
+        Num discountedPayoffAD(const Num& S0, const Num& R, const Num& sigma, const Num& tau, int steps,
+            const std::vector<double>& Zs, bool flip) const;
+
+        /**
+         * @brief Estimateur pathwise de la dérivée du prix par rapport au paramètre @p param.
+         */
+        MCStats pathwiseMC(int paths, int steps, std::uint64_t seed, bool antithetic, Param param) const;
+
+        /**
+         * @brief Gamma d'une trajectoire : différence centrée des deltas pathwise en S0 (1 +/- relEps).
+         *
+         * Remplace k(k-1) P / S0^2 quand le payoff n'est pas homogène (homogeneityDegree < 0).
+         */
+        double pathwiseGammaSample(int steps, const std::vector<double>& Zs, bool flip, double relEps) const;
+
+        /// Nombre de mémoires de travail nécessaires (une par thread).
+        int workerSlots() const { return std::max<int>(1, config_.threads); }
+
+        /**
+         * @brief Ordonnanceur commun des moteurs : simule @p samples échantillons en séquentiel
+         * (flux unique) ou par blocs parallèles (un sous-flux par bloc), voir MCConfig::threads
+         * et MCConfig::rng.
+         *
+         * @tparam SimulateFn Callable : void(NormalGenerator& gen, int count, int worker, MCAccumulator* acc)
+         *                    simulant count échantillons consécutifs tirés dans gen et les ajoutant
+         *                    aux @p outputs accumulateurs acc ; worker identifie la mémoire de travail.
+         * @param stop Si non nul, mode adaptatif : @p samples devient un plafond, la simulation
+         *             avance par tranches et s'arrête dès que stop->stdError <= stop->targetSE
+         *             ou que le budget de temps est épuisé.
+         */
+        template <typename SimulateFn>
+        std::vector<MCAccumulator> runSamples(int samples, std::uint64_t seed, int outputs, SimulateFn&& simulate,
+            StopRule* stop = nullptr) const;
+
+        /**
+         * @brief Prix avec variable de contrôle (MCConfig::control != ControlVariate::None).
+         *
+         * Accumule Y, C et Y + C sur les mêmes trajectoires, puis Option::makeControlVariateStats.
+         */
+        MCStats controlVariateMC(int paths, int steps, std::uint64_t seed, bool antithetic,
+            StopRule* stop = nullptr) const;
+
+        /**
+         * @brief Prix par le noyau vectorisé (MCConfig::kernel == PathKernel::Batched).
+         *
+         * kSimdLanes trajectoires avancent de front dans des tableaux SoA ; les tirages
+         * gaussiens sont identiques à ceux du moteur scalaire.
+         */
+        MCStats runMCBatched(int paths, int steps, std::uint64_t seed, bool antithetic,
+            StopRule* stop = nullptr) const;
+
+        /// Prix (priceMC), en mode adaptatif si @p stop est non nul.
+        MCStats priceMCImpl(int paths, int steps, std::uint64_t seed, bool antithetic, StopRule* stop) const;
+
+        /**
+         * @brief Moteur Monte Carlo vectoriel : accumule @p outputs estimateurs calculés sur les mêmes trajectoires.
+         *
+         * @tparam SampleFn Callable : void(const std::vector<double>& Zs, bool flip, double* out)
+         *                  écrivant @p outputs valeurs dans out.
+         * @param bridgeUniforms Tire steps gaussiennes auxiliaires Zs[steps..2 steps - 1] (extrême
+         *                       continu), comme MCConfig::bridgeCorrection.
+         * @return Un accumulateur de Welford par estimateur.
+         */
+        template <typename SampleFn>
+        std::vector<MCAccumulator> runMCMulti(int paths, int steps, std::uint64_t seed, bool antithetic,
+            int outputs, SampleFn&& sampleFn, StopRule* stop = nullptr, bool bridgeUniforms = false) const;
+
         /**
          * @brief Moteur Monte Carlo générique : calcule moyenne/SE/IC95% d'un estimateur défini "par trajectoire".
          *
@@ -50,11 +367,58 @@ namespace opt {
         {
         }
 
+        /**
+         * @brief Modifie les paramètres d'exécution du moteur Monte Carlo.
+         */
+        void setConfig(const MCConfig& config) { config_ = config; }
+
+        /**
+         * @brief Paramètres d'exécution courants.
+         */
+        const MCConfig& config() const { return config_; }
+
         /**
          * @brief Prix par Monte Carlo (moyenne, erreur standard, IC 95%).
          */
         MCStats priceMC(int paths, int steps, std::uint64_t seed, bool antithetic) const override;
 
+        /**
+         * @brief Prix par Monte Carlo à précision cible : simule par tranches jusqu'à ce que
+         * l'erreur standard passe sous @p targetSE, dans la limite de @p maxPaths trajectoires
+         * et de @p maxSeconds secondes.
+         *
+         * Respecte MCConfig (threads, générateur, noyau, variable de contrôle). Les tranches suivent
+         * la grille des blocs du moteur parallèle : avec threads >= 1 ou Philox, le résultat est
+         * celui de priceMC avec paths = trajectoires utilisées (séquentiel historique : même flux).
+         *
+         * @param targetSE   Erreur standard visée (> 0), en unités de prix.
+         * @param maxPaths   Plafond de trajectoires (> 0).
+         * @param maxSeconds Budget de temps en secondes (0 : aucun) ; vérifié entre deux tranches.
+         * @return Statistiques, trajectoires effectivement simulées et atteinte de la cible.
+         */
+        MCAdaptiveStats priceMCAdaptive(double targetSE, int maxPaths, double maxSeconds,
+            int steps, std::uint64_t seed, bool antithetic) const;
+
+        /**
+         * @brief Prix Monte Carlo multi-niveaux (Giles) du lookback observé sur @p steps dates.
+         *
+         * Niveaux à steps / 2^l pas (l = L..0, tant que steps est pair) ; les corrections
+         * P_l - P_{l-1} couplent trajectoires fine et grossière par les mêmes incréments browniens,
+         * leur variance décroît avec le pas. Une simulation pilote (kMultilevelPilotPaths par niveau)
+         * estime variances et coûts, fixe le niveau le plus grossier (celui qui minimise le coût total)
+         * et les trajectoires par niveau N_l = targetRMSE^-2 sqrt(V_l / C_l) sum_k sqrt(V_k C_k).
+         * Les N_l trajectoires finales sont tirées dans un sous-flux disjoint de celui du pilote :
+         * le choix des niveaux et des N_l, fait sur le pilote, n'est pas corrélé aux échantillons
+         * de l'estimateur.
+         * L'estimateur est sans biais pour le prix à @p steps dates (surveillance discrète), non
+         * pour le lookback continu : seule la variance est ciblée.
+         * Moteur scalaire ; générateur et threads selon MCConfig, deux sous-flux par niveau.
+         *
+         * @param targetRMSE Erreur quadratique moyenne visée (= erreur standard), > 0.
+         * @return Statistiques, trajectoires par niveau et coût en trajectoires fines équivalentes.
+         */
+        MCMultilevelStats priceMLMC(double targetRMSE, int steps, std::uint64_t seed, bool antithetic) const;
+
         /**
          * @brief Delta (dP/dS0) par différence centrée.
          */
@@ -80,6 +444,83 @@ namespace opt {
          */
         MCStats vegaMC(int paths, int steps, std::uint64_t seed, bool antithetic, double eps = 1e-4) const;
 
+        /**
+         * @brief Prix et toutes les grecques en une seule passe sur les trajectoires.
+         *
+         * Chaque vecteur gaussien est tiré une seule fois ; le scénario de base et tous les
+         * scénarios bumpés sont évalués dessus. Pour une même graine, chaque composante est
+         * identique à celle renvoyée par la méthode individuelle correspondante
+         * (priceMC, deltaMC, ...) avec les mêmes epsilons. Si deltaRelEps == gammaRelEps,
+         * les bumps de spot sont partagés entre delta et gamma (9 valorisations par tirage au lieu de 11).
+         * En modes GreekMethod::Pathwise et GreekMethod::Adjoint, les epsilons sont ignorés :
+         * une seule valorisation duale (ou un enregistrement + balayage arrière) par tirage
+         * fournit toutes les grecques.
+         */
+        MCRisk riskMC(int paths, int steps, std::uint64_t seed, bool antithetic,
+            double deltaRelEps = 1e-4, double gammaRelEps = 1e-3, double thetaEps = 1.0 / 365.0,
+            double rhoEps = 1e-4, double vegaEps = 1e-4) const;
+
+        /**
+         * @brief Prix sous une liste de scénarios (S0, R, sigma) avec nombres aléatoires communs.
+         *
+         * Chaque vecteur gaussien est tiré une seule fois et sert à tous les scénarios : les écarts
+         * entre scénarios ne portent pas le bruit de tirages indépendants. Le payoff actualisé étant
+         * homogène de degré TPayoff::homogeneityDegree en S0 (agrégats initialisés à S0), une seule
+         * trajectoire est valorisée par couple (R, sigma) distinct, puis mise à l'échelle pour chaque
+         * spot (homogeneityDegree < 0, ex. strike fixe : une valorisation par scénario distinct).
+         * Chaque résultat égale priceMC (moteur scalaire) du scénario aux arrondis près.
+         *
+         * @return Un MCStats par scénario, dans l'ordre de @p scenarios.
+         * @throw std::invalid_argument si un scénario est invalide (S0 <= 0, sigma < 0, non fini).
+         */
+        std::vector<MCStats> scenarioMC(const std::vector<MCScenario>& scenarios, int paths, int steps,
+            std::uint64_t seed, bool antithetic) const;
+
+        /**
+         * @brief Échelle de risque spot x volatilité (nombres aléatoires communs, voir scenarioMC).
+         *
+         * @param spotShifts Chocs relatifs de spot (S0 (1 + choc)), ex. -0.20 .. +0.20.
+         * @param volShifts  Chocs absolus de volatilité (sigma + choc), ex. -0.05 .. +0.05.
+         * @return Matrice [i][j] : prix pour spotShifts[i] et volShifts[j].
+         */
+        std::vector<std::vector<MCStats>> ladderMC(const std::vector<double>& spotShifts,
+            const std::vector<double>& volShifts, int paths, int steps, std::uint64_t seed, bool antithetic) const;
+
+        /**
+         * @brief Vérifie que riskMC / riskSample s'appliquent (epsilon de theta, payoff lipschitzien
+         * hors différences finies).
+         * @throw std::invalid_argument sinon.
+         */
+        void validateRisk(const RiskBumps& bumps) const;
+
+        /**
+         * @brief Évaluateur par trajectoire de riskMC : écrit (prix, delta, gamma, theta, rho, vega)
+         * pour le vecteur gaussien @p Zs, selon MCConfig::greeks.
+         *
+         * Permet de valoriser plusieurs contrats sur les mêmes tirages (voir Portfolio.h).
+         */
+        void riskSample(const std::vector<double>& Zs, bool flip, int steps, const RiskBumps& bumps, double* out) const;
+
+        /**
+         * @brief Payoff actualisé d'une trajectoire (évaluateur par trajectoire de priceMC).
+         */
+        double priceSample(const std::vector<double>& Zs, bool flip, int steps) const {
+            return discountedPayoffFromZ(S0_, R_, sigma_, T0_, T_, steps, Zs, flip);
+        }
+
+        /**
+         * @brief Ordonnanceur Monte Carlo de l'option (MCConfig : threads, générateur) appliqué à un
+         * évaluateur quelconque : accumule @p outputs estimateurs sur les mêmes trajectoires.
+         *
+         * @tparam SampleFn Callable : void(const std::vector<double>& Zs, bool flip, double* out).
+         */
+        template <typename SampleFn>
+        std::vector<MCAccumulator> simulateMulti(int paths, int steps, std::uint64_t seed, bool antithetic,
+            int outputs, SampleFn&& sampleFn) const
+        {
+            return runMCMulti(paths, steps, seed, antithetic, outputs, std::forward<SampleFn>(sampleFn));
+        }
+
         /**
         * @brief Prix asymptotique de référence avec correction Brownian Bridge (LOOKBACK ONLY).
         *
@@ -107,6 +548,77 @@ namespace opt {
         double Tau = T - T0;
         double dt = Tau / static_cast<double>(steps);
         double disc = std::exp(-R * Tau);
+
+        if (config_.bridgeCorrection) {
+            // Extrême continu par pas : pont brownien en log, gaussiennes Zs[steps + j] -> U
+            const double drift = (R - 0.5 * sigma * sigma) * dt;
+            const double vol = sigma * std::sqrt(dt);
+            const double bridgeVar = 2.0 * sigma * sigma * dt;
+            const double dir = static_cast<double>(extreme_direction<TAggregator>::value);
+            const double sgn = flip ? -1.0 : 1.0;
+            double x = 0.0;
+            double ext = 0.0;
+
+            for (int j = 0; j < steps; ++j) {
+                const double xn = x + drift + vol * (sgn * Zs[j]);
+                const double d = xn - x;
+                const double u = normalCdf(sgn * Zs[steps + j]);
+                ext = aggregator_.apply(ext, 0.5 * (x + xn + dir * std::sqrt(d * d - bridgeVar * std::log(u))),
+                    static_cast<double>(j + 1));
+                x = xn;
+            }
+
+            return disc * payoff_(S0 * std::exp(x), S0 * std::exp(ext));
+        }
+
+        if (config_.logSpace && is_monotone_extreme<TAggregator>::value) {
+            // Log-prix relatif x = log(S/S0), extrême suivi en log : 2 exponentielles par trajectoire
+            const double drift = (R - 0.5 * sigma * sigma) * dt;
+            const double vol = sigma * std::sqrt(dt);
+            const double sgn = flip ? -1.0 : 1.0;
+            double x = 0.0;
+            double ext = 0.0;
+
+            for (int j = 0; j < steps; ++j) {
+                x += drift + vol * (sgn * Zs[j]);
+                ext = aggregator_.apply(ext, x, static_cast<double>(j + 1));
+            }
+
+            return disc * payoff_(S0 * std::exp(x), S0 * std::exp(ext));
+        }
+
+        if (config_.logSpace && is_log_additive<TAggregator>::value) {
+            // Somme des log-prix relatifs : moyenne géométrique S0 exp(sum x / (steps + 1))
+            const double drift = (R - 0.5 * sigma * sigma) * dt;
+            const double vol = sigma * std::sqrt(dt);
+            const double sgn = flip ? -1.0 : 1.0;
+            double x = 0.0;
+            double sum = 0.0;
+
+            for (int j = 0; j < steps; ++j) {
+                x += drift + vol * (sgn * Zs[j]);
+                sum += x;
+            }
+
+            return disc * payoff_(S0 * std::exp(x), S0 * std::exp(sum / static_cast<double>(steps + 1)));
+        }
+
+        if (config_.logSpace) {
+            // État en flux : une mise à jour par pas, valeur agrégée calculée à maturité
+            const double drift = (R - 0.5 * sigma * sigma) * dt;
+            const double vol = sigma * std::sqrt(dt);
+            const double sgn = flip ? -1.0 : 1.0;
+            double St = S0;
+            double state = aggregator_.init(S0);
+
+            for (int j = 0; j < steps; ++j) {
+                St *= std::exp(drift + vol * (sgn * Zs[j]));
+                state = aggregator_.accumulate(state, St);
+            }
+
+            return disc * payoff_(St, aggregator_.finalize(state, steps));
+        }
+
         double St = S0;
         double agg = S0;
 
@@ -119,136 +631,938 @@ namespace opt {
         return disc * payoff_(St, agg);
     }
 
+    template <typename TPayoff, typename TAggregator>
+    double Asian<TPayoff, TAggregator>::antitheticPayoffFromZ(double S0, double R, double sigma,
+        double T0, double T, int steps, const std::vector<double>& Zs) const
+    {
+        const double Tau = T - T0;
+        const double dt = Tau / static_cast<double>(steps);
+        const double disc = std::exp(-R * Tau);
+        const double drift = (R - 0.5 * sigma * sigma) * dt;
+        const double vol = sigma * std::sqrt(dt);
+
+        if (config_.logSpace && is_monotone_extreme<TAggregator>::value) {
+            double xu = 0.0, xd = 0.0;
+            double extU = 0.0, extD = 0.0;
+
+            for (int j = 0; j < steps; ++j) {
+                const double step = static_cast<double>(j + 1);
+                const double shock = vol * Zs[j];
+                xu += drift + shock;
+                xd += drift - shock;
+                extU = aggregator_.apply(extU, xu, step);
+                extD = aggregator_.apply(extD, xd, step);
+            }
+
+            return 0.5 * disc * (payoff_(S0 * std::exp(xu), S0 * std::exp(extU))
+                + payoff_(S0 * std::exp(xd), S0 * std::exp(extD)));
+        }
+
+        if (config_.logSpace && is_log_additive<TAggregator>::value) {
+            double xu = 0.0, xd = 0.0;
+            double sumU = 0.0, sumD = 0.0;
+
+            for (int j = 0; j < steps; ++j) {
+                const double shock = vol * Zs[j];
+                xu += drift + shock;
+                xd += drift - shock;
+                sumU += xu;
+                sumD += xd;
+            }
+
+            const double n1 = static_cast<double>(steps + 1);
+            return 0.5 * disc * (payoff_(S0 * std::exp(xu), S0 * std::exp(sumU / n1))
+                + payoff_(S0 * std::exp(xd), S0 * std::exp(sumD / n1)));
+        }
+
+        // Jambe miroir : exp(drift - vol Z) = exp(2 drift) / exp(drift + vol Z)
+        const double growth2 = std::exp(2.0 * drift);
+        double Su = S0, Sd = S0;
+
+        if (config_.logSpace) {
+            double stateU = aggregator_.init(S0), stateD = aggregator_.init(S0);
+
+            for (int j = 0; j < steps; ++j) {
+                const double inc = std::exp(drift + vol * Zs[j]);
+                Su *= inc;
+                Sd *= growth2 / inc;
+                stateU = aggregator_.accumulate(stateU, Su);
+                stateD = aggregator_.accumulate(stateD, Sd);
+            }
+
+            return 0.5 * disc * (payoff_(Su, aggregator_.finalize(stateU, steps))
+                + payoff_(Sd, aggregator_.finalize(stateD, steps)));
+        }
+
+        double aggU = S0, aggD = S0;
+
+        for (int j = 0; j < steps; ++j) {
+            const double step = static_cast<double>(j + 1);
+            const double inc = std::exp(drift + vol * Zs[j]);
+            Su *= inc;
+            Sd *= growth2 / inc;
+            aggU = aggregator_(aggU, Su, step);
+            aggD = aggregator_(aggD, Sd, step);
+        }
+
+        return 0.5 * disc * (payoff_(Su, aggU) + payoff_(Sd, aggD));
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    template <typename SampleFn>
+    std::vector<MCAccumulator> Asian<TPayoff, TAggregator>::runPayoffMC(int paths, int steps, std::uint64_t seed,
+        bool antithetic, int outputs, SampleFn&& sampleFn, StopRule* stop) const
+    {
+        if (antithetic && config_.fusedAntithetic && !config_.bridgeCorrection) {
+            if (paths <= 0) throw std::invalid_argument("paths doit être > 0.");
+
+            // Une paire par échantillon : mêmes tirages que le moteur antithétique non fusionné
+            return runMCMulti((paths + 1) / 2, steps, seed, false, outputs,
+                [&](const std::vector<double>& Zs, bool, double* out) {
+                    auto P = [&](double S0, double R, double sigma, double T0) {
+                        return antitheticPayoffFromZ(S0, R, sigma, T0, T_, steps, Zs);
+                        };
+                    sampleFn(P, out);
+                }, stop);
+        }
+
+        return runMCMulti(paths, steps, seed, antithetic, outputs,
+            [&](const std::vector<double>& Zs, bool flip, double* out) {
+                auto P = [&](double S0, double R, double sigma, double T0) {
+                    return discountedPayoffFromZ(S0, R, sigma, T0, T_, steps, Zs, flip);
+                    };
+                sampleFn(P, out);
+            }, stop);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    template <typename Num>
+    Num Asian<TPayoff, TAggregator>::discountedPayoffAD(const Num& S0, const Num& R, const Num& sigma,
+        const Num& tau, int steps, const std::vector<double>& Zs, bool flip) const
+    {
+        using std::exp;
+        using std::sqrt;
+
+        Num dt = tau / static_cast<double>(steps);
+        Num disc = exp(-R * tau);
+        Num drift = (R - 0.5 * sigma * sigma) * dt;
+        Num vol = sigma * sqrt(dt);
+
+        if (config_.bridgeCorrection) {
+            // Même pont que discountedPayoffFromZ : extrême différentiable en (x, x', sigma)
+            Num bridgeVar = 2.0 * sigma * sigma * dt;
+            const double dir = static_cast<double>(extreme_direction<TAggregator>::value);
+            Num x(0.0);
+            Num ext(0.0);
+
+            for (int j = 0; j < steps; ++j) {
+                double Z = flip ? -Zs[j] : Zs[j];
+                double logU = std::log(normalCdf(flip ? -Zs[steps + j] : Zs[steps + j]));
+                Num xn = x + drift + vol * Z;
+                Num d = xn - x;
+                ext = aggregator_.apply(ext, 0.5 * (x + xn + dir * sqrt(d * d - bridgeVar * logU)),
+                    static_cast<double>(j + 1));
+                x = xn;
+            }
+
+            return disc * payoff_.eval(S0 * exp(x), S0 * exp(ext));
+        }
+
+        Num St = S0;
+        Num agg = S0;
+
+        for (int j = 0; j < steps; ++j) {
+            double Z = flip ? -Zs[j] : Zs[j];
+            St = St * exp(drift + vol * Z);
+            agg = aggregator_.apply(agg, St, static_cast<double>(j + 1));
+        }
+
+        return disc * payoff_.eval(St, agg);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    MCStats Asian<TPayoff, TAggregator>::pathwiseMC(int paths, int steps, std::uint64_t seed,
+        bool antithetic, Param param) const
+    {
+        if (!TPayoff::isLipschitz)
+            throw std::invalid_argument("Grecques pathwise : payoff discontinu (utiliser les différences finies).");
+
+        using D = Dual<1>;
+        const double tau = T_ - T0_;
+
+        auto samplePathwise = [&](const std::vector<double>& Zs, bool flip) -> double {
+            D S0 = (param == kS0) ? D::variable(S0_, 0) : D(S0_);
+            D R = (param == kR) ? D::variable(R_, 0) : D(R_);
+            D sigma = (param == kSigma) ? D::variable(sigma_, 0) : D(sigma_);
+            // tau = T - T0 : dtau/dT0 = -1
+            D tauD(tau);
+            if (param == kT0) tauD.d[0] = -1.0;
+            return discountedPayoffAD(S0, R, sigma, tauD, steps, Zs, flip).d[0];
+            };
+
+        return runMC(paths, steps, seed, antithetic, samplePathwise);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    double Asian<TPayoff, TAggregator>::pathwiseGammaSample(int steps, const std::vector<double>& Zs, bool flip,
+        double relEps) const
+    {
+        using D = Dual<1>;
+        const double eps = relEps * S0_;
+        const D tau(T_ - T0_);
+
+        auto deltaAt = [&](double S0) {
+            return discountedPayoffAD(D::variable(S0, 0), D(R_), D(sigma_), tau, steps, Zs, flip).d[0];
+            };
+        return (deltaAt(S0_ + eps) - deltaAt(S0_ - eps)) / (2.0 * eps);
+    }
+
     template <typename TPayoff, typename TAggregator>
 	template <typename SampleFn>
-    MCStats Asian<TPayoff, TAggregator>::runMC(int paths, int steps, std::uint64_t seed, 
-        bool antithetic, SampleFn&& sampleFn) const
+    std::vector<MCAccumulator> Asian<TPayoff, TAggregator>::runMCMulti(int paths, int steps, std::uint64_t seed,
+        bool antithetic, int outputs, SampleFn&& sampleFn, StopRule* stop, bool bridgeUniforms) const
     {
         if (paths <= 0) throw std::invalid_argument("paths doit être > 0.");
         if (steps <= 0) throw std::invalid_argument("steps doit être > 0.");
+        if (config_.threads < 0) throw std::invalid_argument("threads doit être >= 0.");
+        if (config_.bridgeCorrection && !is_monotone_extreme<TAggregator>::value)
+            throw std::invalid_argument("Correction de pont : réservée aux agrégateurs min/max.");
 
-        std::mt19937_64 rng(seed);
-        std::normal_distribution<double> nd(0.0, 1.0);
+        // Un échantillon = une paire antithétique moyennée, ou une trajectoire simple
+        const int samples = antithetic ? (paths + 1) / 2 : paths;
+        // Gaussiennes par trajectoire (seconde moitié : uniformes du pont, hors pont brownien en Sobol)
+        const int draws = (config_.bridgeCorrection || bridgeUniforms) ? 2 * steps : steps;
 
-        int m = 0;
-        double mean = 0.0;
-        double M2 = 0.0;
-
-        auto pushSample = [&](double x) {
-            ++m;
-            double d = x - mean;
-            mean += d / m;
-            double d2 = x - mean;
-            M2 += d * d2;
+        // Mémoire de travail réutilisée d'une trajectoire à l'autre (aucune allocation par trajectoire)
+        struct Scratch {
+            std::vector<double> Zs, out1, out2;
+        };
+        std::vector<Scratch> scratch(workerSlots());
+
+        auto simulate = [&](NormalGenerator& gen, int count, int worker, MCAccumulator* acc) {
+            Scratch& w = scratch[worker];
+            w.Zs.resize(draws);
+            w.out1.resize(outputs);
+            w.out2.resize(outputs);
+
+            for (int i = 0; i < count; ++i) {
+                gen.fill(w.Zs.data(), draws, steps);
+
+                sampleFn(w.Zs, false, w.out1.data());
+                if (antithetic) {
+                    sampleFn(w.Zs, true, w.out2.data());
+                    for (int k = 0; k < outputs; ++k) acc[k].push(0.5 * (w.out1[k] + w.out2[k]));
+                }
+                else {
+                    for (int k = 0; k < outputs; ++k) acc[k].push(w.out1[k]);
+                }
+            }
             };
 
-        if (antithetic) {
-            int pairs = (paths + 1) / 2;
-            for (int i = 0; i < pairs; ++i) {
-                std::vector<double> Zs(steps);
-                for (int j = 0; j < steps; ++j) Zs[j] = nd(rng);
-                double s1 = sampleFn(Zs, false);
-                double s2 = sampleFn(Zs, true);
-                double sample = 0.5 * (s1 + s2);
-                pushSample(sample);
+        return runSamples(samples, seed, outputs, simulate, stop);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    template <typename SimulateFn>
+    std::vector<MCAccumulator> Asian<TPayoff, TAggregator>::runSamples(int samples, std::uint64_t seed,
+        int outputs, SimulateFn&& simulate, StopRule* stop) const
+    {
+        const bool sobol = (config_.rng == RngKind::Sobol);
+        if (sobol && config_.qmcRandomisations < 2) throw std::invalid_argument("qmcRandomisations doit être >= 2.");
+
+        // Accumulateurs par randomisation (Sobol) ou total courant ; done = échantillons simulés par slot
+        const int slotsCount = sobol ? config_.qmcRandomisations : 1;
+        const int perSlot = (samples + slotsCount - 1) / slotsCount;
+        const bool serialStream = !sobol && config_.threads == 0;
+        std::vector<MCAccumulator> slots(static_cast<std::size_t>(slotsCount) * outputs);
+        NormalGenerator serial(config_.rng, seed, 0);
+        int done = 0;
+
+        // Simule les échantillons [done, upTo) de chaque slot
+        auto advance = [&](int upTo) {
+            if (serialStream) {
+                // Moteur séquentiel historique : un flux unique
+                simulate(serial, upTo - done, 0, slots.data());
+                done = upTo;
+                return;
             }
+
+            // Blocs de la grille fixe kBlockSamples (éventuellement entamés) : un sous-flux et des
+            // accumulateurs par bloc. Philox : le sous-flux d'un bloc est la suite du compteur ;
+            // Sobol : une graine par randomisation, le bloc démarre à son indice dans la suite.
+            const int b0 = done / kBlockSamples;
+            const int blocks = (upTo + kBlockSamples - 1) / kBlockSamples - b0;
+            const int tasks = slotsCount * blocks;
+            std::vector<MCAccumulator> partial(static_cast<std::size_t>(tasks) * outputs);
+
+            auto task = [&](int t, int worker) {
+                const int r = t / blocks, b = b0 + t % blocks;
+                const int first = std::max<int>(done, b * kBlockSamples);
+                const int count = std::min<int>(upTo, (b + 1) * kBlockSamples) - first;
+                std::uint64_t blockSeed = seed;
+                if (sobol) blockSeed = substreamSeed(seed, static_cast<std::uint64_t>(r));
+                else if (config_.rng != RngKind::Philox) blockSeed = substreamSeed(seed, static_cast<std::uint64_t>(b));
+
+                NormalGenerator gen(config_.rng, blockSeed, static_cast<std::uint64_t>(first));
+                simulate(gen, count, worker, &partial[static_cast<std::size_t>(t) * outputs]);
+                };
+
+            if (config_.threads == 0) {
+                for (int t = 0; t < tasks; ++t) task(t, 0);
+            }
+            else {
+                parallelFor(tasks, config_.threads, task);
+            }
+
+            // Fusion (Chan) dans l'ordre des blocs : indépendante de l'ordonnancement
+            for (int t = 0; t < tasks; ++t)
+                for (int k = 0; k < outputs; ++k)
+                    slots[static_cast<std::size_t>(t / blocks) * outputs + k].merge(partial[static_cast<std::size_t>(t) * outputs + k]);
+            done = upTo;
+            };
+
+        // Sobol : une observation par randomisation, sa moyenne (erreur standard entre randomisations)
+        auto result = [&]() {
+            if (!sobol) return slots;
+            std::vector<MCAccumulator> acc(outputs);
+            for (int k = 0; k < outputs; ++k)
+                for (int r = 0; r < slotsCount; ++r)
+                    acc[k].push(slots[static_cast<std::size_t>(r) * outputs + k].mean);
+            return acc;
+            };
+
+        if (stop == nullptr) {
+            advance(perSlot);
+            return result();
         }
-        else {
-            for (int i = 0; i < paths; ++i) {
-                std::vector<double> Zs(steps);
-                for (int j = 0; j < steps; ++j) Zs[j] = nd(rng);
-                double sample = sampleFn(Zs, false);
-                pushSample(sample);
+
+        // Mode adaptatif : tranches successives jusqu'à l'erreur cible, au plafond ou au budget de temps.
+        // Les tranches suivent la grille des blocs (sous-flux mt19937_64 jamais coupés) ;
+        // en Sobol, la longueur de chaque randomisation double (puissances de 2).
+        const int grain = serialStream ? 1024 : kBlockSamples;
+        int next = sobol ? 256 : (serialStream ? grain : grain * std::max<int>(1, config_.threads));
+
+        for (;;) {
+            advance(std::min<int>(next, perSlot));
+            std::vector<MCAccumulator> acc = result();
+            stop->samples = static_cast<std::int64_t>(done) * slotsCount;
+
+            const double se = stop->stdError(acc);
+            if (se <= stop->targetSE) {
+                stop->converged = true;
+                return acc;
+            }
+            if (done >= perSlot) return acc;
+
+            const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - stop->start).count();
+            if (stop->maxSeconds > 0.0 && elapsed >= stop->maxSeconds) return acc;
+
+            // Projection SE ~ 1/sqrt(n), croissance bornée à x8 par tranche, puis budget de temps restant
+            double want = (std::isfinite(se) && se > 0.0)
+                ? 1.1 * done * (se / stop->targetSE) * (se / stop->targetSE)
+                : 2.0 * done;
+            want = std::min<double>(want, 8.0 * done);
+            if (stop->maxSeconds > 0.0 && elapsed > 0.0)
+                want = std::min<double>(want, done + (stop->maxSeconds - elapsed) * done / elapsed);
+            want = std::min<double>(want, perSlot);
+
+            if (sobol) {
+                next = done;
+                while (next < want && next < perSlot) next *= 2;
+            }
+            else {
+                next = static_cast<int>(std::ceil(want / grain)) * grain;
             }
+            if (std::min<int>(next, perSlot) <= done) return acc;
         }
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    MCStats Asian<TPayoff, TAggregator>::runMCBatched(int paths, int steps, std::uint64_t seed, bool antithetic,
+        StopRule* stop) const
+    {
+        if (paths <= 0) throw std::invalid_argument("paths doit être > 0.");
+        if (steps <= 0) throw std::invalid_argument("steps doit être > 0.");
+        if (config_.threads < 0) throw std::invalid_argument("threads doit être >= 0.");
+
+        const int samples = antithetic ? (paths + 1) / 2 : paths;
 
-        double var = (m > 1) ? (M2 / (m - 1)) : 0.0;
-        double se = (m > 0) ? std::sqrt(var / m) : std::numeric_limits<double>::quiet_NaN();
+        const double Tau = T_ - T0_;
+        const double dt = Tau / static_cast<double>(steps);
+        const double drift = (R_ - 0.5 * sigma_ * sigma_) * dt;
+        const double vol = sigma_ * std::sqrt(dt);
+        const double disc = std::exp(-R_ * Tau);
 
-        return Option::makeCI95(mean, se);
+        // Gaussiennes en structure de tableaux : Zt[j * kSimdLanes + l] = Z_j de la trajectoire l
+        struct Scratch {
+            std::vector<double> Zt, Zp;
+        };
+        std::vector<Scratch> scratch(workerSlots());
+        const auto kernel = selectLookbackBatchKernel<TPayoff, TAggregator>();
+        const bool logSpace = config_.logSpace && is_monotone_extreme<TAggregator>::value;
+
+        auto simulate = [&](NormalGenerator& gen, int count, int worker, MCAccumulator* acc) {
+            std::vector<double>& Zt = scratch[worker].Zt;
+            std::vector<double>& Zp = scratch[worker].Zp;
+            Zt.assign(static_cast<std::size_t>(steps) * kSimdLanes, 0.0);
+            Zp.resize(steps);
+            double out1[kSimdLanes], out2[kSimdLanes];
+
+            for (int i = 0; i < count; i += kSimdLanes) {
+                const int lanes = std::min<int>(kSimdLanes, count - i);
+
+                // Même ordre de tirage que le moteur scalaire (trajectoire par trajectoire)
+                for (int l = 0; l < lanes; ++l) {
+                    gen.fill(Zp.data(), steps);
+                    for (int j = 0; j < steps; ++j) Zt[static_cast<std::size_t>(j) * kSimdLanes + l] = Zp[j];
+                }
+
+                kernel(payoff_, aggregator_, Zt.data(), steps, S0_, drift, vol, disc, false, logSpace, out1);
+                if (antithetic) {
+                    kernel(payoff_, aggregator_, Zt.data(), steps, S0_, drift, vol, disc, true, logSpace, out2);
+                    for (int l = 0; l < lanes; ++l) acc[0].push(0.5 * (out1[l] + out2[l]));
+                }
+                else {
+                    for (int l = 0; l < lanes; ++l) acc[0].push(out1[l]);
+                }
+            }
+            };
+
+        auto acc = runSamples(samples, seed, 1, simulate, stop);
+        return Option::makeCI95(acc[0].mean, acc[0].stdError());
     }
 
     template <typename TPayoff, typename TAggregator>
-    MCStats Asian<TPayoff, TAggregator>::priceMC(int paths, int steps, std::uint64_t seed, bool antithetic) const
+	template <typename SampleFn>
+    MCStats Asian<TPayoff, TAggregator>::runMC(int paths, int steps, std::uint64_t seed, 
+        bool antithetic, SampleFn&& sampleFn) const
     {
-        auto samplePrice = [&](const std::vector<double>& Zs, bool flip) -> double {
-            return discountedPayoffFromZ(S0_, R_, sigma_, T0_, T_, steps, Zs, flip);
+        auto acc = runMCMulti(paths, steps, seed, antithetic, 1,
+            [&](const std::vector<double>& Zs, bool flip, double* out) {
+                out[0] = sampleFn(Zs, flip);
+            });
+
+        return Option::makeCI95(acc[0].mean, acc[0].stdError());
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    MCStats Asian<TPayoff, TAggregator>::controlVariateMC(int paths, int steps, std::uint64_t seed,
+        bool antithetic, StopRule* stop) const
+    {
+        using Closed = ContinuousLookbackPrice<TPayoff, TAggregator>;
+        const bool continuous = (config_.control == ControlVariate::ContinuousExtreme);
+        if (continuous && !Closed::available)
+            throw std::invalid_argument("Contrôle continu : réservé aux lookbacks call/min et put/max.");
+        if (steps <= 0) throw std::invalid_argument("steps doit être > 0.");
+
+        const double tau = T_ - T0_;
+        const double dt = tau / static_cast<double>(steps);
+        const double nu = R_ - 0.5 * sigma_ * sigma_;
+        const double drift = nu * dt;
+        const double vol = sigma_ * std::sqrt(dt);
+        const double bridgeVar = 2.0 * sigma_ * sigma_ * dt;
+        const double disc = std::exp(-R_ * tau);
+        const double n = static_cast<double>(steps);
+
+        // log G ~ N(log S0 + nu dt n/2, sigma^2 dt n(2n+1) / (6(n+1)))
+        const double controlMean = continuous
+            ? Closed::value(S0_, R_, sigma_, T0_, T_)
+            : disc * S0_ * std::exp(drift * n / 2.0 + sigma_ * sigma_ * dt * n * (2.0 * n + 1.0) / (12.0 * (n + 1.0)));
+
+        auto sample = [&](const std::vector<double>& Zs, bool flip, double* out) {
+            const double y = discountedPayoffFromZ(S0_, R_, sigma_, T0_, T_, steps, Zs, flip);
+            const double sgn = flip ? -1.0 : 1.0;
+            double x = 0.0;   // log(S/S0)
+            double c;
+
+            if (continuous) {
+                // Extrême du pont entre x et x' : (x + x' +/- sqrt((x' - x)^2 - 2 sigma^2 dt log U)) / 2
+                double ext = 0.0;
+                for (int j = 0; j < steps; ++j) {
+                    const double xn = x + drift + vol * (sgn * Zs[j]);
+                    const double u = normalCdf(sgn * Zs[steps + j]);
+                    const double d = xn - x;
+                    const double bridge = 0.5 * (x + xn + Closed::extremeSign * std::sqrt(d * d - bridgeVar * std::log(u)));
+                    ext = aggregator_.apply(ext, bridge, static_cast<double>(j + 1));
+                    x = xn;
+                }
+                c = disc * payoff_(S0_ * std::exp(x), S0_ * std::exp(ext));
+            }
+            else {
+                double logSum = 0.0;
+                for (int j = 0; j < steps; ++j) {
+                    x += drift + vol * (sgn * Zs[j]);
+                    logSum += x;
+                }
+                c = disc * S0_ * std::exp(logSum / (n + 1.0));
+            }
+
+            out[0] = y;
+            out[1] = c;
+            out[2] = y + c;
+            };
+
+        if (stop != nullptr) {
+            stop->stdError = [](const std::vector<MCAccumulator>& acc) {
+                return Option::makeControlVariateStats(acc[0], acc[1], acc[2], 0.0).stdError;
+                };
+        }
+
+        // Extrême continu : uniformes Zs[steps + j] (les mêmes qu'avec MCConfig::bridgeCorrection)
+        auto acc = runMCMulti(paths, steps, seed, antithetic, 3, sample, stop, continuous);
+        return Option::makeControlVariateStats(acc[0], acc[1], acc[2], controlMean);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    MCStats Asian<TPayoff, TAggregator>::priceMCImpl(int paths, int steps, std::uint64_t seed, bool antithetic,
+        StopRule* stop) const
+    {
+        if (config_.control != ControlVariate::None)
+            return controlVariateMC(paths, steps, seed, antithetic, stop);
+        if (config_.kernel == PathKernel::Batched && !config_.bridgeCorrection)
+            return runMCBatched(paths, steps, seed, antithetic, stop);
+
+        auto samplePrice = [&](const auto& P, double* out) {
+            out[0] = P(S0_, R_, sigma_, T0_);
             };
 
-        return runMC(paths, steps, seed, antithetic, samplePrice);
+        auto acc = runPayoffMC(paths, steps, seed, antithetic, 1, samplePrice, stop);
+        return Option::makeCI95(acc[0].mean, acc[0].stdError());
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    MCStats Asian<TPayoff, TAggregator>::priceMC(int paths, int steps, std::uint64_t seed, bool antithetic) const
+    {
+        return priceMCImpl(paths, steps, seed, antithetic, nullptr);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    MCAdaptiveStats Asian<TPayoff, TAggregator>::priceMCAdaptive(double targetSE, int maxPaths, double maxSeconds,
+        int steps, std::uint64_t seed, bool antithetic) const
+    {
+        if (!(targetSE > 0.0)) throw std::invalid_argument("targetSE doit être > 0.");
+        if (maxPaths <= 0) throw std::invalid_argument("maxPaths doit être > 0.");
+        if (!(maxSeconds >= 0.0)) throw std::invalid_argument("maxSeconds doit être >= 0 (0 : pas de limite).");
+
+        StopRule rule;
+        rule.targetSE = targetSE;
+        rule.maxSeconds = maxSeconds;
+        rule.stdError = [](const std::vector<MCAccumulator>& acc) { return acc[0].stdError(); };
+
+        MCAdaptiveStats out;
+        out.stats = priceMCImpl(maxPaths, steps, seed, antithetic, &rule);
+        out.paths = antithetic ? 2 * rule.samples : rule.samples;
+        out.converged = rule.converged;
+        return out;
     }
 
     template <typename TPayoff, typename TAggregator>
     MCStats Asian<TPayoff, TAggregator>::deltaMC(int paths, int steps, std::uint64_t seed, 
         bool antithetic, double relEps) const
     {
+        if (config_.greeks != GreekMethod::FiniteDifference)
+            return pathwiseMC(paths, steps, seed, antithetic, kS0);
+
         double eps = relEps * S0_;
 
-        auto sampleDelta = [&](const std::vector<double>& Zs, bool flip) -> double {
-            double Pu = discountedPayoffFromZ(S0_ + eps, R_, sigma_, T0_, T_, steps, Zs, flip);
-            double Pd = discountedPayoffFromZ(S0_ - eps, R_, sigma_, T0_, T_, steps, Zs, flip);
-            return (Pu - Pd) / (2.0 * eps);
+        auto sampleDelta = [&](const auto& P, double* out) {
+            double Pu = P(S0_ + eps, R_, sigma_, T0_);
+            double Pd = P(S0_ - eps, R_, sigma_, T0_);
+            out[0] = (Pu - Pd) / (2.0 * eps);
             };
 
-        return runMC(paths, steps, seed, antithetic, sampleDelta);
+        auto acc = runPayoffMC(paths, steps, seed, antithetic, 1, sampleDelta);
+        return Option::makeCI95(acc[0].mean, acc[0].stdError());
     }
 
     template <typename TPayoff, typename TAggregator>
     MCStats Asian<TPayoff, TAggregator>::gammaMC(int paths, int steps, std::uint64_t seed, 
         bool antithetic, double relEps) const
     {
+        if (config_.greeks != GreekMethod::FiniteDifference && TPayoff::homogeneityDegree < 0) {
+            if (!TPayoff::isLipschitz)
+                throw std::invalid_argument("Grecques pathwise : payoff discontinu (utiliser les différences finies).");
+            auto sampleGammaPW = [&](const std::vector<double>& Zs, bool flip) -> double {
+                return pathwiseGammaSample(steps, Zs, flip, relEps);
+                };
+            return runMC(paths, steps, seed, antithetic, sampleGammaPW);
+        }
+
+        if (config_.greeks != GreekMethod::FiniteDifference) {
+            // Homogénéité de degré k : gamma = k(k-1) P / S0^2 (voir GreekMethod::Pathwise)
+            const double k = static_cast<double>(TPayoff::homogeneityDegree);
+            auto sampleGammaH = [&](const auto& P, double* out) {
+                out[0] = k * (k - 1.0) * P(S0_, R_, sigma_, T0_) / (S0_ * S0_);
+                };
+            auto acc = runPayoffMC(paths, steps, seed, antithetic, 1, sampleGammaH);
+            return Option::makeCI95(acc[0].mean, acc[0].stdError());
+        }
+
         double eps = relEps * S0_;
 
-        auto sampleGamma = [&](const std::vector<double>& Zs, bool flip) -> double {
-            double Pu = discountedPayoffFromZ(S0_ + eps, R_, sigma_, T0_, T_, steps, Zs, flip);
-            double Pm = discountedPayoffFromZ(S0_, R_, sigma_, T0_, T_, steps, Zs, flip);
-            double Pd = discountedPayoffFromZ(S0_ - eps, R_, sigma_, T0_, T_, steps, Zs, flip);
-            return (Pu - 2.0 * Pm + Pd) / (eps * eps);
+        auto sampleGamma = [&](const auto& P, double* out) {
+            double Pu = P(S0_ + eps, R_, sigma_, T0_);
+            double Pm = P(S0_, R_, sigma_, T0_);
+            double Pd = P(S0_ - eps, R_, sigma_, T0_);
+            out[0] = (Pu - 2.0 * Pm + Pd) / (eps * eps);
             };
 
-        return runMC(paths, steps, seed, antithetic, sampleGamma);
+        auto acc = runPayoffMC(paths, steps, seed, antithetic, 1, sampleGamma);
+        return Option::makeCI95(acc[0].mean, acc[0].stdError());
     }
 
     template <typename TPayoff, typename TAggregator>
     MCStats Asian<TPayoff, TAggregator>::thetaMC(int paths, int steps, std::uint64_t seed, 
         bool antithetic, double eps) const
     {
+        if (config_.greeks != GreekMethod::FiniteDifference)
+            return pathwiseMC(paths, steps, seed, antithetic, kT0);
+
         if (!(T0_ + eps < T_ && T0_ - eps < T_))
             throw std::invalid_argument("Theta: eps trop grand par rapport à T0/T.");
 
-        auto sampleTheta = [&](const std::vector<double>& Zs, bool flip) -> double {
-            double Pu = discountedPayoffFromZ(S0_, R_, sigma_, T0_ + eps, T_, steps, Zs, flip);
-            double Pd = discountedPayoffFromZ(S0_, R_, sigma_, T0_ - eps, T_, steps, Zs, flip);
-            return (Pu - Pd) / (2.0 * eps);
+        auto sampleTheta = [&](const auto& P, double* out) {
+            double Pu = P(S0_, R_, sigma_, T0_ + eps);
+            double Pd = P(S0_, R_, sigma_, T0_ - eps);
+            out[0] = (Pu - Pd) / (2.0 * eps);
             };
 
-        return runMC(paths, steps, seed, antithetic, sampleTheta);
+        auto acc = runPayoffMC(paths, steps, seed, antithetic, 1, sampleTheta);
+        return Option::makeCI95(acc[0].mean, acc[0].stdError());
     }
 
     template <typename TPayoff, typename TAggregator>
     MCStats Asian<TPayoff, TAggregator>::rhoMC(int paths, int steps, std::uint64_t seed, 
         bool antithetic, double eps) const
     {
-        auto sampleRho = [&](const std::vector<double>& Zs, bool flip) -> double {
-            double Pu = discountedPayoffFromZ(S0_, R_ + eps, sigma_, T0_, T_, steps, Zs, flip);
-            double Pd = discountedPayoffFromZ(S0_, R_ - eps, sigma_, T0_, T_, steps, Zs, flip);
-            return (Pu - Pd) / (2.0 * eps);
+        if (config_.greeks != GreekMethod::FiniteDifference)
+            return pathwiseMC(paths, steps, seed, antithetic, kR);
+
+        auto sampleRho = [&](const auto& P, double* out) {
+            double Pu = P(S0_, R_ + eps, sigma_, T0_);
+            double Pd = P(S0_, R_ - eps, sigma_, T0_);
+            out[0] = (Pu - Pd) / (2.0 * eps);
             };
 
-        return runMC(paths, steps, seed, antithetic, sampleRho);
+        auto acc = runPayoffMC(paths, steps, seed, antithetic, 1, sampleRho);
+        return Option::makeCI95(acc[0].mean, acc[0].stdError());
     }
 
     template <typename TPayoff, typename TAggregator>
     MCStats Asian<TPayoff, TAggregator>::vegaMC(int paths, int steps, std::uint64_t seed, 
         bool antithetic, double eps) const
     {
-        auto sampleVega = [&](const std::vector<double>& Zs, bool flip) -> double {
-            double Pu = discountedPayoffFromZ(S0_, R_, sigma_ + eps, T0_, T_, steps, Zs, flip);
-            double Pd = discountedPayoffFromZ(S0_, R_, sigma_ - eps, T0_, T_, steps, Zs, flip);
-            return (Pu - Pd) / (2.0 * eps);
+        if (config_.greeks != GreekMethod::FiniteDifference)
+            return pathwiseMC(paths, steps, seed, antithetic, kSigma);
+
+        auto sampleVega = [&](const auto& P, double* out) {
+            double Pu = P(S0_, R_, sigma_ + eps, T0_);
+            double Pd = P(S0_, R_, sigma_ - eps, T0_);
+            out[0] = (Pu - Pd) / (2.0 * eps);
+            };
+
+        auto acc = runPayoffMC(paths, steps, seed, antithetic, 1, sampleVega);
+        return Option::makeCI95(acc[0].mean, acc[0].stdError());
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    void Asian<TPayoff, TAggregator>::multilevelSample(int steps, const std::vector<double>& Zs, bool flip,
+        double* out) const
+    {
+        const double fine = discountedPayoffFromZ(S0_, R_, sigma_, T0_, T_, steps, Zs, flip);
+
+        const int coarseSteps = steps / 2;
+        const double tau = T_ - T0_;
+        const double dt = tau / static_cast<double>(coarseSteps);
+        const double drift = (R_ - 0.5 * sigma_ * sigma_) * dt;
+        const double vol = sigma_ * std::sqrt(0.5 * dt);   // sqrt(dt) (Z1 + Z2) / sqrt(2)
+        const double sgn = flip ? -1.0 : 1.0;
+
+        double St = S0_;
+        double agg = S0_;
+        for (int k = 0; k < coarseSteps; ++k) {
+            St *= std::exp(drift + vol * sgn * (Zs[2 * k] + Zs[2 * k + 1]));
+            agg = aggregator_(agg, St, static_cast<double>(k + 1));
+        }
+        const double coarse = std::exp(-R_ * tau) * payoff_(St, agg);
+
+        out[0] = fine - coarse;
+        out[1] = fine;
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    MCMultilevelStats Asian<TPayoff, TAggregator>::priceMLMC(double targetRMSE, int steps, std::uint64_t seed,
+        bool antithetic) const
+    {
+        if (!(targetRMSE > 0.0)) throw std::invalid_argument("targetRMSE doit être > 0.");
+        if (steps <= 0) throw std::invalid_argument("steps doit être > 0.");
+        if (config_.bridgeCorrection)
+            throw std::invalid_argument("MLMC : cible à surveillance discrète, incompatible avec la correction de pont.");
+
+        // Niveaux : Ms[l] = steps / 2^(L - l), du plus grossier (l = 0) au plus fin (l = L)
+        std::vector<int> Ms(1, steps);
+        while (Ms.front() % 2 == 0) Ms.insert(Ms.begin(), Ms.front() / 2);
+        const int L = static_cast<int>(Ms.size()) - 1;
+
+        // Sous-flux du niveau l : pair pour le pilote, impair pour l'estimation finale
+        auto levelSeed = [&](int l, bool final) {
+            return substreamSeed(seed, 2 * static_cast<std::uint64_t>(L - l) + (final ? 1 : 0));
+            };
+        // Prix seul au niveau l (niveau de départ)
+        auto runPlain = [&](int l, int paths, bool final) {
+            return runMCMulti(paths, Ms[l], levelSeed(l, final), antithetic, 1,
+                [&](const std::vector<double>& Zs, bool flip, double* out) {
+                    out[0] = discountedPayoffFromZ(S0_, R_, sigma_, T0_, T_, Ms[l], Zs, flip);
+                })[0];
+            };
+        // Correction couplée au niveau l : {P_l - P_{l-1}, P_l} ; au niveau 0, {P_0, P_0}
+        auto runLevel = [&](int l, int paths, bool final) {
+            if (l == 0) return std::vector<MCAccumulator>(2, runPlain(0, paths, final));
+            return runMCMulti(paths, Ms[l], levelSeed(l, final), antithetic, 2,
+                [&](const std::vector<double>& Zs, bool flip, double* out) { multilevelSample(Ms[l], Zs, flip, out); });
+            };
+        // Variance par trajectoire, cohérente avec l'erreur standard du moteur (paires, QMC)
+        auto pathVariance = [](const MCAccumulator& acc, int paths) {
+            const double se = acc.stdError();
+            return se * se * static_cast<double>(paths);
+            };
+
+        // Pilote : variance des corrections V[l] et du prix seul W[l] à chaque niveau
+        const int pilot = kMultilevelPilotPaths;
+        std::vector<std::vector<MCAccumulator>> pilotAcc(L + 1);
+        std::vector<double> V(L + 1), W(L + 1), C(L + 1);
+        for (int l = 0; l <= L; ++l) {
+            pilotAcc[l] = runLevel(l, pilot, false);
+            V[l] = pathVariance(pilotAcc[l][0], pilot);
+            W[l] = pathVariance(pilotAcc[l][1], pilot);
+            C[l] = (l == 0) ? Ms[l] : 1.5 * Ms[l];
+        }
+
+        // Niveau de départ l0 : minimise (sqrt(W C) + sum_{l > l0} sqrt(V C))^2
+        int l0 = L;
+        double best = std::numeric_limits<double>::infinity();
+        for (int start = L; start >= 0; --start) {
+            double sum = std::sqrt(W[start] * Ms[start]);
+            for (int l = start + 1; l <= L; ++l) sum += std::sqrt(V[l] * C[l]);
+            if (sum < best) { best = sum; l0 = start; }
+        }
+
+        MCMultilevelStats result;
+        result.coarsestSteps = Ms[l0];
+        double mean = 0.0;
+        double var = 0.0;
+
+        for (int l = l0; l <= L; ++l) {
+            const bool base = (l == l0);
+            const double v = base ? W[l] : V[l];
+            const double c = base ? Ms[l] : C[l];
+            const double n = std::ceil(std::sqrt(v / c) * best / (targetRMSE * targetRMSE));
+            const int paths = static_cast<int>(std::min<double>(
+                std::max<double>(n, kMultilevelMinPaths), (std::numeric_limits<int>::max)()));
+
+            // Tirages indépendants du pilote qui a fixé l0 et N_l
+            const MCAccumulator acc = base ? runPlain(l, paths, true) : runLevel(l, paths, true)[0];
+            result.paths.push_back(paths);
+            result.cost += static_cast<double>(paths) * c;
+
+            const double se = acc.stdError();
+            mean += acc.mean;
+            var += se * se;
+        }
+
+        // Coût du pilote inclus
+        for (int l = 0; l <= L; ++l) result.cost += static_cast<double>(pilot) * C[l];
+        result.cost /= static_cast<double>(steps);
+
+        result.stats = Option::makeCI95(mean, std::sqrt(var));
+        return result;
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    std::vector<MCStats> Asian<TPayoff, TAggregator>::scenarioMC(const std::vector<MCScenario>& scenarios,
+        int paths, int steps, std::uint64_t seed, bool antithetic) const
+    {
+        const int n = static_cast<int>(scenarios.size());
+        if (n == 0) return std::vector<MCStats>();
+
+        // Regroupement par (R, sigma) : une valorisation au spot de référence S0_ par groupe
+        // (payoff non homogène : par (S0, R, sigma), sans mise à l'échelle)
+        const bool homogeneous = TPayoff::homogeneityDegree >= 0;
+        std::vector<MCScenario> groups;
+        std::vector<int> groupOf(n);
+        std::vector<double> scale(n);
+        const double k = static_cast<double>(TPayoff::homogeneityDegree);
+
+        for (int i = 0; i < n; ++i) {
+            const MCScenario& sc = scenarios[i];
+            if (!(std::isfinite(sc.S0) && std::isfinite(sc.R) && std::isfinite(sc.sigma) && sc.S0 > 0.0 && sc.sigma >= 0.0))
+                throw std::invalid_argument("Scénario invalide (S0 > 0, sigma >= 0, valeurs finies).");
+
+            const MCScenario key{ homogeneous ? S0_ : sc.S0, sc.R, sc.sigma };
+            int g = 0;
+            while (g < static_cast<int>(groups.size())
+                && !(groups[g].S0 == key.S0 && groups[g].R == key.R && groups[g].sigma == key.sigma)) ++g;
+            if (g == static_cast<int>(groups.size())) groups.push_back(key);
+
+            groupOf[i] = g;
+            scale[i] = homogeneous ? std::pow(sc.S0 / S0_, k) : 1.0;
+        }
+
+        std::vector<std::vector<int>> members(groups.size());
+        for (int i = 0; i < n; ++i) members[groupOf[i]].push_back(i);
+
+        auto sample = [&](const std::vector<double>& Zs, bool flip, double* out) {
+            for (std::size_t g = 0; g < groups.size(); ++g) {
+                double v = discountedPayoffFromZ(groups[g].S0, groups[g].R, groups[g].sigma, T0_, T_, steps, Zs, flip);
+                for (int i : members[g]) out[i] = scale[i] * v;
+            }
             };
 
-        return runMC(paths, steps, seed, antithetic, sampleVega);
+        auto acc = runMCMulti(paths, steps, seed, antithetic, n, sample);
+
+        std::vector<MCStats> out(n);
+        for (int i = 0; i < n; ++i) out[i] = Option::makeCI95(acc[i].mean, acc[i].stdError());
+        return out;
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    std::vector<std::vector<MCStats>> Asian<TPayoff, TAggregator>::ladderMC(const std::vector<double>& spotShifts,
+        const std::vector<double>& volShifts, int paths, int steps, std::uint64_t seed, bool antithetic) const
+    {
+        std::vector<MCScenario> scenarios;
+        scenarios.reserve(spotShifts.size() * volShifts.size());
+        for (double ds : spotShifts)
+            for (double dv : volShifts)
+                scenarios.push_back(MCScenario{ S0_ * (1.0 + ds), R_, sigma_ + dv });
+
+        std::vector<MCStats> flat = scenarioMC(scenarios, paths, steps, seed, antithetic);
+
+        std::vector<std::vector<MCStats>> out(spotShifts.size());
+        for (std::size_t i = 0; i < spotShifts.size(); ++i)
+            out[i].assign(flat.begin() + i * volShifts.size(), flat.begin() + (i + 1) * volShifts.size());
+        return out;
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    void Asian<TPayoff, TAggregator>::validateRisk(const RiskBumps& bumps) const
+    {
+        if (config_.greeks == GreekMethod::FiniteDifference && !(T0_ + bumps.thetaEps < T_ && T0_ - bumps.thetaEps < T_))
+            throw std::invalid_argument("Theta: eps trop grand par rapport à T0/T.");
+        if (config_.greeks != GreekMethod::FiniteDifference && !TPayoff::isLipschitz)
+            throw std::invalid_argument("Grecques pathwise : payoff discontinu (utiliser les différences finies).");
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    void Asian<TPayoff, TAggregator>::riskSample(const std::vector<double>& Zs, bool flip, int steps,
+        const RiskBumps& bumps, double* out) const
+    {
+        const double k = static_cast<double>(TPayoff::homogeneityDegree);
+
+        if (config_.greeks == GreekMethod::Pathwise) {
+            // Une seule valorisation duale (4 directions) par trajectoire
+            using D = Dual<4>;
+            D tau(T_ - T0_);
+            tau.d[kT0] = -1.0;
+            D P = discountedPayoffAD(D::variable(S0_, kS0), D::variable(R_, kR), D::variable(sigma_, kSigma),
+                tau, steps, Zs, flip);
+
+            out[0] = P.v;
+            out[1] = P.d[kS0];
+            out[2] = (TPayoff::homogeneityDegree >= 0) ? k * (k - 1.0) * P.v / (S0_ * S0_)
+                : pathwiseGammaSample(steps, Zs, flip, bumps.gammaRelEps);
+            out[3] = P.d[kT0];
+            out[4] = P.d[kR];
+            out[5] = P.d[kSigma];
+            return;
+        }
+
+        if (config_.greeks == GreekMethod::Adjoint) {
+            // Enregistrement de la trajectoire puis un balayage arrière
+            Tape& tape = Tape::local();
+            tape.clear();
+            AReal S0 = AReal::variable(S0_);
+            AReal R = AReal::variable(R_);
+            AReal sigma = AReal::variable(sigma_);
+            AReal tau = AReal::variable(T_ - T0_);
+            AReal P = discountedPayoffAD(S0, R, sigma, tau, steps, Zs, flip);
+            tape.propagate(P.idx);
+
+            out[0] = P.v;
+            out[1] = tape.adjoint(S0.idx);
+            out[2] = (TPayoff::homogeneityDegree >= 0) ? k * (k - 1.0) * P.v / (S0_ * S0_)
+                : pathwiseGammaSample(steps, Zs, flip, bumps.gammaRelEps);
+            out[3] = -tape.adjoint(tau.idx);  // dtau/dT0 = -1
+            out[4] = tape.adjoint(R.idx);
+            out[5] = tape.adjoint(sigma.idx);
+            return;
+        }
+
+        riskFromPayoffs([&](double S0, double R, double sigma, double T0) {
+            return discountedPayoffFromZ(S0, R, sigma, T0, T_, steps, Zs, flip);
+            }, bumps, out);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    template <typename PayoffAt>
+    void Asian<TPayoff, TAggregator>::riskFromPayoffs(const PayoffAt& Pf, const RiskBumps& bumps, double* out) const
+    {
+        const double epsD = bumps.deltaRelEps * S0_;
+        const double epsG = bumps.gammaRelEps * S0_;
+        const double thetaEps = bumps.thetaEps, rhoEps = bumps.rhoEps, vegaEps = bumps.vegaEps;
+
+        double P = Pf(S0_, R_, sigma_, T0_);
+
+        double PuD = Pf(S0_ + epsD, R_, sigma_, T0_);
+        double PdD = Pf(S0_ - epsD, R_, sigma_, T0_);
+        double PuG = PuD, PdG = PdD;
+        if (bumps.deltaRelEps != bumps.gammaRelEps) {
+            PuG = Pf(S0_ + epsG, R_, sigma_, T0_);
+            PdG = Pf(S0_ - epsG, R_, sigma_, T0_);
+        }
+
+        double PuT = Pf(S0_, R_, sigma_, T0_ + thetaEps);
+        double PdT = Pf(S0_, R_, sigma_, T0_ - thetaEps);
+        double PuR = Pf(S0_, R_ + rhoEps, sigma_, T0_);
+        double PdR = Pf(S0_, R_ - rhoEps, sigma_, T0_);
+        double PuV = Pf(S0_, R_, sigma_ + vegaEps, T0_);
+        double PdV = Pf(S0_, R_, sigma_ - vegaEps, T0_);
+
+        out[0] = P;
+        out[1] = (PuD - PdD) / (2.0 * epsD);
+        out[2] = (PuG - 2.0 * P + PdG) / (epsG * epsG);
+        out[3] = (PuT - PdT) / (2.0 * thetaEps);
+        out[4] = (PuR - PdR) / (2.0 * rhoEps);
+        out[5] = (PuV - PdV) / (2.0 * vegaEps);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    MCRisk Asian<TPayoff, TAggregator>::riskMC(int paths, int steps, std::uint64_t seed, bool antithetic,
+        double deltaRelEps, double gammaRelEps, double thetaEps, double rhoEps, double vegaEps) const
+    {
+        RiskBumps bumps;
+        bumps.deltaRelEps = deltaRelEps;
+        bumps.gammaRelEps = gammaRelEps;
+        bumps.thetaEps = thetaEps;
+        bumps.rhoEps = rhoEps;
+        bumps.vegaEps = vegaEps;
+        validateRisk(bumps);
+
+        auto acc = (config_.greeks == GreekMethod::FiniteDifference)
+            ? runPayoffMC(paths, steps, seed, antithetic, 6,
+                [&](const auto& P, double* out) { riskFromPayoffs(P, bumps, out); })
+            : runMCMulti(paths, steps, seed, antithetic, 6,
+                [&](const std::vector<double>& Zs, bool flip, double* out) {
+                    riskSample(Zs, flip, steps, bumps, out);
+                });
+
+        MCRisk risk;
+        risk.price = Option::makeCI95(acc[0].mean, acc[0].stdError());
+        risk.delta = Option::makeCI95(acc[1].mean, acc[1].stdError());
+        risk.gamma = Option::makeCI95(acc[2].mean, acc[2].stdError());
+        risk.theta = Option::makeCI95(acc[3].mean, acc[3].stdError());
+        risk.rho = Option::makeCI95(acc[4].mean, acc[4].stdError());
+        risk.vega = Option::makeCI95(acc[5].mean, acc[5].stdError());
+        return risk;
     }
 
     template <typename TPayoff, typename TAggregator>
@@ -328,18 +1642,19 @@ namespace opt {
 
         double sumPayoff = 0.0;
 
+        // Mémoire de travail allouée une fois, réutilisée pour chaque trajectoire
+        std::vector<double> Zs(steps), Umax(steps), Umin(steps);
+
         if (antithetic) {
             const int pairs = paths / 2;
             for (int i = 0; i < pairs; ++i) {
 
                 // 1) Génère Zs
-                std::vector<double> Zs(steps);
                 for (int j = 0; j < steps; ++j)
                     Zs[j] = nd(rng);
 
                 // 2) Génère aussi les U (uniformes) une fois par paire, puis réutilisés pour flip=true
                 //    => partie "bridge" corrélée entre (Z) et (-Z)
-                std::vector<double> Umax(steps), Umin(steps);
                 for (int j = 0; j < steps; ++j) {
                     double u1 = ud(rng);
                     double u2 = ud(rng);
@@ -359,11 +1674,9 @@ namespace opt {
         else {
             for (int i = 0; i < paths; ++i) {
 
-                std::vector<double> Zs(steps);
                 for (int j = 0; j < steps; ++j)
                     Zs[j] = nd(rng);
 
-                std::vector<double> Umax(steps), Umin(steps);
                 for (int j = 0; j < steps; ++j) {
                     double u1 = ud(rng);
                     double u2 = ud(rng);
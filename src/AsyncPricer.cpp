@@ -0,0 +1,205 @@
+#include "pch.h"
+#include "AsyncPricer.h"
+#include "Aggregator.h"
+#include "Payoff.h"
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+namespace opt {
+
+    namespace {
+
+        void appendStats(std::vector<double>& out, const MCStats& stats) {
+            out.push_back(stats.estimate);
+            out.push_back(stats.stdError);
+            out.push_back(stats.ciLow);
+            out.push_back(stats.ciHigh);
+        }
+
+        template <typename Option>
+        std::vector<double> runLookbackJob(Option option, const LookbackJob& job) {
+            option.setConfig(job.config);
+            std::vector<double> out;
+
+            if (job.measure == JobMeasure::Risk) {
+                MCRisk risk = option.riskMC(job.paths, job.steps, job.seed, job.antithetic);
+                appendStats(out, risk.price);
+                appendStats(out, risk.delta);
+                appendStats(out, risk.gamma);
+                appendStats(out, risk.theta);
+                appendStats(out, risk.rho);
+                appendStats(out, risk.vega);
+            }
+            else {
+                appendStats(out, option.priceMC(job.paths, job.steps, job.seed, job.antithetic));
+            }
+            return out;
+        }
+
+    } // namespace
+
+    AsyncPricer::AsyncPricer(int workers, std::size_t maxFinished) : maxFinished_(maxFinished)
+    {
+        if (workers < 1) throw std::invalid_argument("workers doit être >= 1.");
+        workers_.reserve(workers);
+        for (int w = 0; w < workers; ++w) workers_.emplace_back(&AsyncPricer::workerLoop, this);
+    }
+
+    AsyncPricer::~AsyncPricer()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        ready_.notify_all();
+        for (auto& th : workers_) th.join();
+    }
+
+    AsyncPricer& AsyncPricer::instance()
+    {
+        static AsyncPricer* pool = new AsyncPricer(
+            std::max<int>(1, static_cast<int>(std::thread::hardware_concurrency()) - 1));
+        return *pool;
+    }
+
+    std::int64_t AsyncPricer::submit(Task task)
+    {
+        if (!task) throw std::invalid_argument("Calcul vide.");
+
+        std::int64_t id;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            id = nextId_++;
+            jobs_[id].task = std::move(task);
+            queue_.push_back(id);
+        }
+        ready_.notify_one();
+        return id;
+    }
+
+    std::int64_t AsyncPricer::submit(const LookbackJob& job)
+    {
+        // Validation immédiate : une erreur de paramètres remonte à la soumission, pas au collect
+        if (job.type == LookbackType::Call) {
+            Asian<FloatingCallPayoff, LookMin> option(job.S0, job.R, job.sigma, job.T0, job.T, FloatingCallPayoff(), LookMin());
+            return submit([option, job]() { return runLookbackJob(option, job); });
+        }
+        if (job.type == LookbackType::Put) {
+            Asian<FloatingPutPayoff, LookMax> option(job.S0, job.R, job.sigma, job.T0, job.T, FloatingPutPayoff(), LookMax());
+            return submit([option, job]() { return runLookbackJob(option, job); });
+        }
+        throw std::invalid_argument("Type de lookback inconnu (0 : call, 1 : put).");
+    }
+
+    JobStatus AsyncPricer::status(std::int64_t id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(id);
+        return (it == jobs_.end()) ? JobStatus::Unknown : it->second.status;
+    }
+
+    JobStatus AsyncPricer::collect(std::int64_t id, std::vector<double>& out, std::string& error)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(id);
+        if (it == jobs_.end()) return JobStatus::Unknown;
+
+        const JobStatus s = it->second.status;
+        if (s == JobStatus::Done) out.swap(it->second.result);
+        else if (s == JobStatus::Failed) error.swap(it->second.error);
+        else return s;
+
+        finished_.erase(it->second.finishedPos);
+        jobs_.erase(it);
+        return s;
+    }
+
+    std::size_t AsyncPricer::resultSize(std::int64_t id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(id);
+        return (it == jobs_.end() || it->second.status != JobStatus::Done) ? 0 : it->second.result.size();
+    }
+
+    bool AsyncPricer::cancel(std::int64_t id)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(id);
+        if (it == jobs_.end() || it->second.status != JobStatus::Pending) return false;
+
+        queue_.erase(std::find(queue_.begin(), queue_.end(), id));
+        jobs_.erase(it);
+        return true;
+    }
+
+    int AsyncPricer::jobs() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return static_cast<int>(jobs_.size());
+    }
+
+    void AsyncPricer::setMaxFinished(std::size_t maxFinished)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        maxFinished_ = maxFinished;
+        evictFinished();
+    }
+
+    std::size_t AsyncPricer::maxFinished() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return maxFinished_;
+    }
+
+    void AsyncPricer::evictFinished()
+    {
+        while (finished_.size() > maxFinished_) {
+            jobs_.erase(finished_.front());
+            finished_.pop_front();
+        }
+    }
+
+    void AsyncPricer::workerLoop()
+    {
+        for (;;) {
+            std::int64_t id;
+            Task task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (stopping_) return;
+
+                id = queue_.front();
+                queue_.pop_front();
+                Job& job = jobs_[id];
+                job.status = JobStatus::Running;
+                task = std::move(job.task);
+            }
+
+            // Calcul hors verrou ; le job ne peut pas être collecté ni annulé tant qu'il est Running
+            std::vector<double> result;
+            std::string error;
+            bool ok = false;
+            try {
+                result = task();
+                ok = true;
+            }
+            catch (const std::exception& e) {
+                error = e.what();
+            }
+            catch (...) {
+                error = "Erreur inconnue dans le calcul asynchrone.";
+            }
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            Job& job = jobs_[id];
+            job.status = ok ? JobStatus::Done : JobStatus::Failed;
+            job.result.swap(result);
+            job.error.swap(error);
+            job.finishedPos = finished_.insert(finished_.end(), id);
+            evictFinished();
+        }
+    }
+
+} // namespace opt
@@ -0,0 +1,176 @@
+#ifndef ASYNCPRICER_H
+#define ASYNCPRICER_H
+
+#include "Portfolio.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace opt {
+
+    /**
+     * @brief État d'un calcul asynchrone.
+     */
+    enum class JobStatus : int {
+        Unknown = -1,  ///< Identifiant inconnu (jamais soumis ou déjà collecté).
+        Pending = 0,   ///< En file d'attente.
+        Running = 1,   ///< En cours sur un thread de travail.
+        Done = 2,      ///< Résultat disponible.
+        Failed = 3     ///< Exception levée par le calcul (message conservé).
+    };
+
+    /**
+     * @brief Grandeur calculée par un job lookback.
+     */
+    enum class JobMeasure : int {
+        Price = 0,  ///< priceMC : 4 doubles (estimateur, SE, IC bas, IC haut).
+        Risk = 1    ///< riskMC : 24 doubles (prix, delta, gamma, theta, rho, vega ; 4 doubles chacun).
+    };
+
+    /**
+     * @brief Paramètres d'une valorisation lookback asynchrone (copiés à la soumission).
+     */
+    struct LookbackJob {
+        LookbackType type = LookbackType::Call;
+        JobMeasure measure = JobMeasure::Price;
+        double S0 = 0.0;
+        double R = 0.0;
+        double sigma = 0.0;
+        double T0 = 0.0;
+        double T = 0.0;
+        int paths = 0;
+        int steps = 0;
+        std::uint64_t seed = 0;
+        bool antithetic = false;
+        MCConfig config;   ///< Configuration du moteur (séquentiel par défaut : un job par thread).
+    };
+
+    /**
+     * @brief File de calculs et pool de threads de travail (appelant jamais bloqué).
+     *
+     * submit place un calcul en file et rend immédiatement un identifiant ; les threads de
+     * travail exécutent les jobs dans l'ordre de soumission. L'appelant interroge status puis
+     * récupère le résultat avec collect, qui libère le job. Toutes les méthodes sont thread-safe.
+     *
+     * Un job terminé (Done ou Failed) jamais collecté (cellule Excel recalculée ou supprimée)
+     * est conservé dans la limite de maxFinished : au-delà, les plus anciens terminés sont
+     * évincés et deviennent Unknown.
+     */
+    class AsyncPricer {
+    public:
+        /// Calcul soumis : renvoie le vecteur de résultats.
+        using Task = std::function<std::vector<double>()>;
+
+        /// Nombre par défaut de jobs terminés non collectés conservés.
+        static constexpr std::size_t kDefaultMaxFinished = 1024;
+
+        /**
+         * @param workers     Nombre de threads de travail (>= 1).
+         * @param maxFinished Jobs terminés non collectés conservés (voir setMaxFinished).
+         * @throw std::invalid_argument si workers < 1.
+         */
+        explicit AsyncPricer(int workers, std::size_t maxFinished = kDefaultMaxFinished);
+
+        /**
+         * @brief Arrête le pool : les jobs en file sont abandonnés, les jobs en cours terminés.
+         */
+        ~AsyncPricer();
+
+        AsyncPricer(const AsyncPricer&) = delete;
+        AsyncPricer& operator=(const AsyncPricer&) = delete;
+
+        /**
+         * @brief Pool partagé des exports (hardware_concurrency - 1 threads, au moins 1).
+         *
+         * Jamais détruit : à la fin du processus, joindre des threads pendant le déchargement
+         * de la DLL (verrou du chargeur) bloquerait.
+         */
+        static AsyncPricer& instance();
+
+        /**
+         * @brief Met un calcul en file.
+         * @return Identifiant du job (> 0).
+         */
+        std::int64_t submit(Task task);
+
+        /**
+         * @brief Met en file une valorisation lookback (priceMC ou riskMC, voir JobMeasure).
+         */
+        std::int64_t submit(const LookbackJob& job);
+
+        /**
+         * @brief État courant du job @p id.
+         */
+        JobStatus status(std::int64_t id) const;
+
+        /**
+         * @brief Récupère le résultat d'un job terminé et le libère.
+         *
+         * @param out   Reçoit les résultats si le job est Done.
+         * @param error Reçoit le message d'exception si le job est Failed.
+         * @return L'état du job ; seuls Done et Failed libèrent le job.
+         */
+        JobStatus collect(std::int64_t id, std::vector<double>& out, std::string& error);
+
+        /**
+         * @brief Nombre de doubles du résultat d'un job Done (0 sinon), sans le libérer.
+         *
+         * Permet de vérifier un tampon avant collect : le résultat d'un job Done ne change plus.
+         */
+        std::size_t resultSize(std::int64_t id) const;
+
+        /**
+         * @brief Retire un job encore en file.
+         * @return true si le job était Pending (il ne sera pas exécuté).
+         */
+        bool cancel(std::int64_t id);
+
+        /**
+         * @brief Nombre de jobs non collectés (en file, en cours ou terminés).
+         */
+        int jobs() const;
+
+        /**
+         * @brief Change le nombre maximal de jobs terminés non collectés (évince immédiatement
+         * les plus anciens en surplus). 0 : tout résultat non collecté à la fin du job est perdu.
+         */
+        void setMaxFinished(std::size_t maxFinished);
+
+        std::size_t maxFinished() const;
+
+    private:
+        struct Job {
+            Task task;
+            JobStatus status = JobStatus::Pending;
+            std::vector<double> result;
+            std::string error;
+            std::list<std::int64_t>::iterator finishedPos;   ///< Position dans finished_ (Done / Failed).
+        };
+
+        void workerLoop();
+
+        /// Évince les plus anciens jobs terminés au-delà de maxFinished_ (verrou détenu).
+        void evictFinished();
+
+        mutable std::mutex mutex_;
+        std::condition_variable ready_;
+        std::deque<std::int64_t> queue_;          ///< Jobs Pending, ordre de soumission.
+        std::map<std::int64_t, Job> jobs_;        ///< Jobs non collectés.
+        std::list<std::int64_t> finished_;        ///< Jobs terminés non collectés, du plus ancien au plus récent.
+        std::size_t maxFinished_;
+        std::int64_t nextId_ = 1;
+        bool stopping_ = false;
+        std::vector<std::thread> workers_;
+    };
+
+} // namespace opt
+
+#endif // ASYNCPRICER_H
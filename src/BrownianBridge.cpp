@@ -0,0 +1,64 @@
+#include "pch.h"
+#include "BrownianBridge.h"
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace opt {
+
+    BrownianBridge::BrownianBridge(int steps)
+        : steps_(steps)
+    {
+        if (steps <= 0) throw std::invalid_argument("steps doit être > 0.");
+
+        bridge_.resize(steps);
+        left_.resize(steps);
+        right_.resize(steps);
+        leftWeight_.resize(steps);
+        rightWeight_.resize(steps);
+        stdDev_.resize(steps);
+
+        // Temps en unités de pas : W(0) = 0, W(steps) = sqrt(steps) z[0]
+        bridge_[0] = steps;
+        left_[0] = 0;
+        right_[0] = steps;
+        leftWeight_[0] = 0.0;
+        rightWeight_[0] = 0.0;
+        stdDev_[0] = std::sqrt(static_cast<double>(steps));
+
+        // Bissections en largeur d'abord (file des intervalles [l, r])
+        std::vector<std::pair<int, int>> queue;
+        queue.reserve(steps);
+        queue.emplace_back(0, steps);
+        int k = 1;
+
+        for (std::size_t q = 0; q < queue.size(); ++q) {
+            const int l = queue[q].first, r = queue[q].second;
+            if (r - l < 2) continue;
+
+            const int m = l + (r - l) / 2;
+            const double span = static_cast<double>(r - l);
+            bridge_[k] = m;
+            left_[k] = l;
+            right_[k] = r;
+            leftWeight_[k] = static_cast<double>(r - m) / span;
+            rightWeight_[k] = static_cast<double>(m - l) / span;
+            stdDev_[k] = std::sqrt(static_cast<double>(m - l) * static_cast<double>(r - m) / span);
+            ++k;
+
+            queue.emplace_back(l, m);
+            queue.emplace_back(m, r);
+        }
+    }
+
+    void BrownianBridge::transform(const double* z, double* Z) const {
+        // Z[i - 1] contient d'abord W(i) (W(0) = 0), puis les incréments
+        auto W = [Z](int i) { return (i == 0) ? 0.0 : Z[i - 1]; };
+
+        for (int k = 0; k < steps_; ++k)
+            Z[bridge_[k] - 1] = leftWeight_[k] * W(left_[k]) + rightWeight_[k] * W(right_[k]) + stdDev_[k] * z[k];
+
+        for (int j = steps_ - 1; j > 0; --j) Z[j] -= Z[j - 1];
+    }
+
+} // namespace opt
@@ -0,0 +1,44 @@
+#ifndef BROWNIAN_BRIDGE_H
+#define BROWNIAN_BRIDGE_H
+
+#include <vector>
+
+namespace opt {
+
+    /**
+     * @brief Construction d'une trajectoire brownienne par pont (bissections successives).
+     *
+     * La première gaussienne fixe W(T), les suivantes les milieux des intervalles en largeur
+     * d'abord : les premières coordonnées d'une suite à faible discrépance portent l'essentiel
+     * de la variance de la trajectoire, ce qui réduit la dimension effective du problème QMC.
+     */
+    class BrownianBridge {
+    public:
+        BrownianBridge() : steps_(0) {}
+
+        /**
+         * @brief Prépare le pont pour @p steps pas de temps égaux.
+         *
+         * @throws std::invalid_argument si steps <= 0.
+         */
+        explicit BrownianBridge(int steps);
+
+        int steps() const { return steps_; }
+
+        /**
+         * @brief Transforme les gaussiennes @p z (ordre d'importance) en incréments réduits.
+         *
+         * @param z Gaussiennes i.i.d., z[0] pour W(T), puis les milieux successifs.
+         * @param Z Sortie : Z[j] = (W(t_{j+1}) - W(t_j)) / sqrt(dt), i.i.d. N(0,1).
+         */
+        void transform(const double* z, double* Z) const;
+
+    private:
+        int steps_;
+        std::vector<int> bridge_, left_, right_;     ///< Point construit et ses voisins (indices de pas)
+        std::vector<double> leftWeight_, rightWeight_, stdDev_;
+    };
+
+} // namespace opt
+
+#endif // BROWNIAN_BRIDGE_H
@@ -1,62 +1,419 @@
 ﻿#include "pch.h"
 #include "Exports.h"
 
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <string>
+
+#ifdef _WIN32
+#pragma comment(lib, "oleaut32.lib")
+#endif
+
 //=============================================================================
 // Factorisation du code 
 //=============================================================================
 
-static bool g_errorDisplayed = false;
+/// Boîte de dialogue d'erreur (opt-in, voir opt_set_error_dialog) et affichage unique.
+static std::atomic<bool> g_errorDialog{ false };
+static std::atomic<bool> g_errorDisplayed{ false };
+
+/**
+ * @brief Dernière erreur du thread appelant (remise à OPT_OK à chaque appel d'export).
+ */
+struct LastError {
+    int code = OPT_OK;
+    std::string message;   ///< Message de l'exception (UTF-8).
+    std::string source;    ///< Nom de l'export en échec.
+};
+
+static thread_local LastError t_lastError;
 
-extern "C" __declspec(dllexport) void __stdcall ResetErrorFlag()
+extern "C" OPT_API void OPT_CALL ResetErrorFlag()
 {
     g_errorDisplayed = false;
 }
 
 /**
- * @brief Affiche une boîte d'erreur une seule fois.
- * @param msg Le message d'erreur à afficher.
- * @param title Le titre de la boîte de dialogue.
+ * @brief Vide le cache des résultats MC (à appeler après changement de version de la DLL
+ * ou pour forcer un recalcul) et remet ses compteurs à zéro.
+ */
+extern "C" OPT_API void OPT_CALL ResetResultCache()
+{
+    opt::ResultCache::instance().clear();
+}
+
+static void clearLastError()
+{
+    t_lastError.code = OPT_OK;
+    t_lastError.message.clear();
+    t_lastError.source.clear();
+}
+
+/**
+ * @brief Code d'erreur d'une exception (voir OptErrorCode).
+ */
+static int errorCodeOf(const std::exception& e)
+{
+    if (dynamic_cast<const std::invalid_argument*>(&e) != nullptr) return OPT_ERR_INVALID_ARGUMENT;
+    if (dynamic_cast<const std::bad_alloc*>(&e) != nullptr) return OPT_ERR_OUT_OF_MEMORY;
+    return OPT_ERR_RUNTIME;
+}
+
+/**
+ * @brief Enregistre l'erreur du thread appelant ; si la boîte de dialogue est activée,
+ * l'affiche une seule fois (jusqu'à ResetErrorFlag).
+ * @param code  Code d'erreur (OptErrorCode).
+ * @param msg   Le message d'erreur.
+ * @param title Nom de l'export (titre de la boîte de dialogue).
  * @return NaN pour signaler l'erreur au code appelant.
  */
-double reportError(const char* msg, const char* title) {
-    if (!g_errorDisplayed) {
+double reportError(int code, const char* msg, const char* title) {
+    try {
+        t_lastError.code = code;
+        t_lastError.message = msg;
+        t_lastError.source = title;
+    }
+    catch (...) {
+        // Mémoire épuisée : le code seul reste disponible
+        t_lastError.code = OPT_ERR_OUT_OF_MEMORY;
+    }
+
+#ifdef _WIN32
+    if (g_errorDialog && !g_errorDisplayed.exchange(true)) {
         wchar_t wmsg[256], wtitle[256];
         MultiByteToWideChar(CP_UTF8, 0, msg, -1, wmsg, 256);
         MultiByteToWideChar(CP_UTF8, 0, title, -1, wtitle, 256);
         MessageBoxW(nullptr, wmsg, wtitle, MB_OK | MB_ICONERROR);
-        g_errorDisplayed = true;
     }
+#endif
     return std::nan("");
 }
 
 /**
- * @brief Déclare une fonction extern "C" __stdcall retournant un double protégée par try/catch.
+ * @brief Déclare une fonction extern "C" OPT_CALL (__stdcall sous Windows) retournant un double
+ * protégée par try/catch.
+ *
+ * La dernière erreur du thread est remise à OPT_OK à l'entrée, renseignée en cas d'exception.
  * @param name Identifiant de la fonction exportée.
  * @param args Signature (entre parenthèses) de la fonction.
  * @param body Code à exécuter (doit inclure un return).
  */
 #define SAFE_DOUBLE(name, args, body)               \
-extern "C" double __stdcall name args {             \
+extern "C" double OPT_CALL name args {             \
+    clearLastError();                               \
     try { body; }                                   \
     catch(const std::exception& e) {                \
-        return reportError(e.what(), #name);        \
+        return reportError(errorCodeOf(e), e.what(), #name); \
     }                                               \
     catch(...) {                                    \
-        return reportError("Erreur inconnue dans " #name, #name); \
+        return reportError(OPT_ERR_UNKNOWN, "Erreur inconnue dans " #name, #name); \
     }                                               \
 }
 
+/**
+ * @brief Copie @p text (UTF-8) dans @p buffer, tronqué et terminé par un zéro.
+ * @return Longueur complète de @p text (hors zéro final).
+ */
+static int copyErrorText(const std::string& text, char* buffer, int size)
+{
+    if (buffer != nullptr && size > 0) {
+        const std::size_t n = std::min<std::size_t>(text.size(), static_cast<std::size_t>(size - 1));
+        std::memcpy(buffer, text.data(), n);
+        buffer[n] = '\0';
+    }
+    return static_cast<int>(text.size());
+}
+
+// Helpers de sortie "résultat complet" (estimateur, SE, IC bas, IC haut)
+
+/**
+ * @brief Vérifie le tampon de sortie et l'initialise à NaN (valeur laissée en cas d'erreur).
+ */
+static void prepareStats(double* out)
+{
+    if (out == nullptr) throw std::invalid_argument("Tampon de sortie nul.");
+    for (int k = 0; k < 4; ++k) out[k] = std::nan("");
+}
+
+/**
+ * @brief Écrit estimate, stdError, ciLow, ciHigh dans un tampon de 4 doubles.
+ * @return L'estimateur.
+ */
+static double writeStats(double* out, const opt::MCStats& stats)
+{
+    out[0] = stats.estimate;
+    out[1] = stats.stdError;
+    out[2] = stats.ciLow;
+    out[3] = stats.ciHigh;
+    return stats.estimate;
+}
+
+#ifdef _WIN32
+
+/**
+ * @brief Vérifie le tableau VBA de sortie (passé ByRef : SAFEARRAY**).
+ */
+static void prepareStats(SAFEARRAY** out)
+{
+    if (out == nullptr) throw std::invalid_argument("Tableau de sortie nul.");
+}
+
+/**
+ * @brief Écrit estimate, stdError, ciLow, ciHigh dans un tableau VBA Double (1 x 4).
+ *
+ * Le tableau est créé s'il n'est pas alloué (Dim r() As Double), redimensionné sinon.
+ * @return L'estimateur.
+ */
+static double writeStats(SAFEARRAY** out, const opt::MCStats& stats)
+{
+    SAFEARRAYBOUND bound;
+    bound.cElements = 4;
+    bound.lLbound = 0;
+
+    if (*out == nullptr) {
+        *out = SafeArrayCreate(VT_R8, 1, &bound);
+        if (*out == nullptr) throw std::runtime_error("Allocation du tableau de sortie impossible.");
+    }
+    else {
+        VARTYPE vt = VT_EMPTY;
+        if (SafeArrayGetDim(*out) != 1 || FAILED(SafeArrayGetVartype(*out, &vt)) || vt != VT_R8)
+            throw std::invalid_argument("Le tableau de sortie doit être un tableau Double à une dimension.");
+        if (FAILED(SafeArrayRedim(*out, &bound)))
+            throw std::invalid_argument("Le tableau de sortie doit être dynamique (Dim r() As Double).");
+    }
+
+    double* data = nullptr;
+    if (FAILED(SafeArrayAccessData(*out, reinterpret_cast<void**>(&data))))
+        throw std::runtime_error("Accès au tableau de sortie impossible.");
+    writeStats(data, stats);
+    SafeArrayUnaccessData(*out);
+    return stats.estimate;
+}
+
+#endif // _WIN32
+
+/**
+ * @brief Écrit prix et grecques (6 x 4 doubles) dans un tampon fourni par l'appelant.
+ *
+ * Ordre : prix, delta, gamma, theta, rho, vega ; chacun (estimateur, SE, IC bas, IC haut).
+ * @return Le prix estimé.
+ */
+static double writeRisk(double* out, const opt::MCRisk& risk)
+{
+    if (out == nullptr) throw std::invalid_argument("Tampon de sortie nul.");
+    writeStats(out + 0, risk.price);
+    writeStats(out + 4, risk.delta);
+    writeStats(out + 8, risk.gamma);
+    writeStats(out + 12, risk.theta);
+    writeStats(out + 16, risk.rho);
+    writeStats(out + 20, risk.vega);
+    return risk.price.estimate;
+}
+
+/**
+ * @brief Écrit le résultat d'un prix à précision cible dans un tampon de 5 doubles.
+ *
+ * Ordre : estimateur, SE, IC bas, IC haut, trajectoires simulées.
+ * @return L'estimateur.
+ */
+static double writeAdaptive(double* out, const opt::MCAdaptiveStats& result)
+{
+    if (out == nullptr) throw std::invalid_argument("Tampon de sortie nul.");
+    writeStats(out, result.stats);
+    out[4] = static_cast<double>(result.paths);
+    return result.stats.estimate;
+}
+
+/**
+ * @brief Écrit le résultat d'un prix MLMC dans un tampon de 6 doubles.
+ *
+ * Ordre : estimateur, SE, IC bas, IC haut, coût (trajectoires fines équivalentes), pas du niveau grossier.
+ * @return L'estimateur.
+ */
+static double writeMultilevel(double* out, const opt::MCMultilevelStats& result)
+{
+    if (out == nullptr) throw std::invalid_argument("Tampon de sortie nul.");
+    writeStats(out, result.stats);
+    out[4] = result.cost;
+    out[5] = static_cast<double>(result.coarsestSteps);
+    return result.stats.estimate;
+}
+
+/**
+ * @brief Calcule une échelle spot x volatilité et l'écrit ligne par ligne (choc de spot).
+ *
+ * @param priceSE Tampon optionnel (nullptr : SE non écrites).
+ * @return Le prix du premier point.
+ */
+template <typename TOption>
+static double writeLadder(const TOption& option, int paths, int steps, std::uint64_t seed, int antithetic,
+    int nSpot, const double* spotShifts, int nVol, const double* volShifts, double* price, double* priceSE)
+{
+    if (nSpot <= 0 || nVol <= 0 || spotShifts == nullptr || volShifts == nullptr)
+        throw std::invalid_argument("Échelle vide.");
+    if (price == nullptr) throw std::invalid_argument("Tampon de sortie nul.");
+
+    auto ladder = option.ladderMC(std::vector<double>(spotShifts, spotShifts + nSpot),
+        std::vector<double>(volShifts, volShifts + nVol), paths, steps, seed, antithetic != 0);
+
+    for (int i = 0; i < nSpot; ++i) {
+        for (int j = 0; j < nVol; ++j) {
+            price[i * nVol + j] = ladder[i][j].estimate;
+            if (priceSE != nullptr) priceSE[i * nVol + j] = ladder[i][j].stdError;
+        }
+    }
+    return ladder[0][0].estimate;
+}
+
+/**
+ * @brief Déclare une paire d'exports "résultat complet" pour une grandeur MC :
+ *  - name(..., double* out)       : tampon de 4 doubles fourni par l'appelant ;
+ *  - name##_xl(..., SAFEARRAY** out) : tableau VBA, pour les formules matricielles Excel
+ *    (Windows uniquement).
+ * Une seule simulation alimente les quatre statistiques.
+ * @param name Identifiant de la fonction exportée.
+ * @param expr Expression retournant un opt::MCStats.
+ */
+#define SAFE_STATS_BUFFER(name, expr)                                           \
+SAFE_DOUBLE(name,                                                               \
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, \
+        double* out),                                                           \
+    { prepareStats(out); return writeStats(out, expr); })
+
+#ifdef _WIN32
+#define SAFE_STATS(name, expr)                                                  \
+SAFE_STATS_BUFFER(name, expr)                                                   \
+SAFE_DOUBLE(name##_xl,                                                          \
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, \
+        SAFEARRAY** out),                                                       \
+    { prepareStats(out); return writeStats(out, expr); })
+#else
+#define SAFE_STATS(name, expr) SAFE_STATS_BUFFER(name, expr)
+#endif
+
+/**
+ * @brief Configuration des exports : antithétiques fusionnés pour les variantes _vr (une
+ * exponentielle par pas pour la paire), sans effet sur les exports sans antithétiques.
+ */
+inline opt::MCConfig exportConfig()
+{
+    opt::MCConfig config;
+    config.fusedAntithetic = true;
+    return config;
+}
+
 // Helper de construction
-inline opt::Asian<opt::PayoffCall, opt::LookMin>
+inline opt::Asian<opt::FloatingCallPayoff, opt::LookMin>
     makeLookbackCall(double S0, double R, double sigma, double T0, double T)
 {
-    return opt::Asian<opt::PayoffCall, opt::LookMin>(S0, R, sigma, T0, T, opt::PayoffCall(), opt::LookMin());
+    opt::Asian<opt::FloatingCallPayoff, opt::LookMin> option(S0, R, sigma, T0, T, opt::FloatingCallPayoff(), opt::LookMin());
+    option.setConfig(exportConfig());
+    return option;
 }
 
-inline opt::Asian<opt::PayoffPut, opt::LookMax>
+inline opt::Asian<opt::FloatingPutPayoff, opt::LookMax>
     makeLookbackPut(double S0, double R, double sigma, double T0, double T)
 {
-    return opt::Asian<opt::PayoffPut, opt::LookMax>(S0, R, sigma, T0, T, opt::PayoffPut(), opt::LookMax());
+    opt::Asian<opt::FloatingPutPayoff, opt::LookMax> option(S0, R, sigma, T0, T, opt::FloatingPutPayoff(), opt::LookMax());
+    option.setConfig(exportConfig());
+    return option;
+}
+
+inline opt::Asian<opt::FixedCallPayoff, opt::LookMax>
+    makeFixedLookbackCall(double S0, double R, double sigma, double T0, double T, double K)
+{
+    opt::Asian<opt::FixedCallPayoff, opt::LookMax> option(S0, R, sigma, T0, T, opt::FixedCallPayoff(K), opt::LookMax());
+    option.setConfig(exportConfig());
+    return option;
+}
+
+inline opt::Asian<opt::FixedPutPayoff, opt::LookMin>
+    makeFixedLookbackPut(double S0, double R, double sigma, double T0, double T, double K)
+{
+    opt::Asian<opt::FixedPutPayoff, opt::LookMin> option(S0, R, sigma, T0, T, opt::FixedPutPayoff(K), opt::LookMin());
+    option.setConfig(exportConfig());
+    return option;
+}
+
+/**
+ * @brief Copie de l'option avec la méthode de grecques @p greeks (0 : différences finies,
+ * 1 : pathwise, 2 : adjoint).
+ */
+template <typename TOption>
+TOption withGreekMethod(TOption option, int greeks)
+{
+    if (greeks < 0 || greeks > 2)
+        throw std::invalid_argument("greeks : 0 (différences finies), 1 (pathwise) ou 2 (adjoint).");
+    opt::MCConfig config = option.config();
+    config.greeks = static_cast<opt::GreekMethod>(greeks);
+    option.setConfig(config);
+    return option;
+}
+
+/**
+ * @brief Copie de l'option avec la correction de pont brownien (surveillance continue).
+ */
+template <typename TOption>
+TOption withBridgeCorrection(TOption option)
+{
+    opt::MCConfig config = option.config();
+    config.bridgeCorrection = true;
+    option.setConfig(config);
+    return option;
+}
+
+/**
+ * @brief Grandeur MC d'une option, mémorisée dans le cache partagé (opt::ResultCache).
+ *
+ * Le moteur étant déterministe à graine fixée, les exports frères (_se, _ci_low, _ci_high)
+ * et les recalculs à arguments identiques réutilisent la même simulation.
+ */
+template <typename TOption>
+static opt::MCStats cachedStats(const TOption& option, opt::LookbackType type, opt::CachedQuantity quantity,
+    double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, bool antithetic)
+{
+    opt::PricingKey key;
+    key.option = static_cast<int>(type);
+    key.quantity = quantity;
+    key.antithetic = antithetic;
+    key.S0 = S0;
+    key.R = R;
+    key.sigma = sigma;
+    key.T0 = T0;
+    key.T = T;
+    key.paths = paths;
+    key.steps = steps;
+    key.seed = seed;
+
+    opt::MCStats stats;
+    if (opt::ResultCache::instance().find(key, stats)) return stats;
+
+    switch (quantity) {
+    case opt::CachedQuantity::Price: stats = option.priceMC(paths, steps, seed, antithetic); break;
+    case opt::CachedQuantity::Delta: stats = option.deltaMC(paths, steps, seed, antithetic); break;
+    case opt::CachedQuantity::Gamma: stats = option.gammaMC(paths, steps, seed, antithetic); break;
+    case opt::CachedQuantity::Theta: stats = option.thetaMC(paths, steps, seed, antithetic); break;
+    case opt::CachedQuantity::Rho: stats = option.rhoMC(paths, steps, seed, antithetic); break;
+    case opt::CachedQuantity::Vega: stats = option.vegaMC(paths, steps, seed, antithetic); break;
+    }
+
+    opt::ResultCache::instance().insert(key, stats);
+    return stats;
+}
+
+static opt::MCStats cachedLookbackCall(opt::CachedQuantity quantity, double S0, double R, double sigma,
+    double T0, double T, int paths, int steps, std::uint64_t seed, bool antithetic)
+{
+    return cachedStats(makeLookbackCall(S0, R, sigma, T0, T), opt::LookbackType::Call, quantity,
+        S0, R, sigma, T0, T, paths, steps, seed, antithetic);
+}
+
+static opt::MCStats cachedLookbackPut(opt::CachedQuantity quantity, double S0, double R, double sigma,
+    double T0, double T, int paths, int steps, std::uint64_t seed, bool antithetic)
+{
+    return cachedStats(makeLookbackPut(S0, R, sigma, T0, T), opt::LookbackType::Put, quantity,
+        S0, R, sigma, T0, T, paths, steps, seed, antithetic);
 }
 
 // ============================================================================
@@ -66,7 +423,7 @@ inline opt::Asian<opt::PayoffPut, opt::LookMax>
 SAFE_DOUBLE(opt_lb_call_price_mc, 
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).priceMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -74,7 +431,7 @@ SAFE_DOUBLE(opt_lb_call_price_mc,
 SAFE_DOUBLE(opt_lb_call_price_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).priceMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -82,7 +439,7 @@ SAFE_DOUBLE(opt_lb_call_price_mc_se,
 SAFE_DOUBLE(opt_lb_call_price_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).priceMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -90,7 +447,7 @@ SAFE_DOUBLE(opt_lb_call_price_mc_ci_low,
 SAFE_DOUBLE(opt_lb_call_price_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).priceMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -102,7 +459,7 @@ SAFE_DOUBLE(opt_lb_call_price_mc_ci_high,
 SAFE_DOUBLE(opt_lb_call_price_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).priceMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -110,7 +467,7 @@ SAFE_DOUBLE(opt_lb_call_price_mc_vr,
 SAFE_DOUBLE(opt_lb_call_price_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).priceMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -118,7 +475,7 @@ SAFE_DOUBLE(opt_lb_call_price_mc_vr_se,
 SAFE_DOUBLE(opt_lb_call_price_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).priceMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -126,7 +483,7 @@ SAFE_DOUBLE(opt_lb_call_price_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_call_price_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).priceMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -138,7 +495,7 @@ SAFE_DOUBLE(opt_lb_call_price_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_call_delta_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -146,7 +503,7 @@ SAFE_DOUBLE(opt_lb_call_delta_mc,
 SAFE_DOUBLE(opt_lb_call_delta_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -154,7 +511,7 @@ SAFE_DOUBLE(opt_lb_call_delta_mc_se,
 SAFE_DOUBLE(opt_lb_call_delta_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -162,7 +519,7 @@ SAFE_DOUBLE(opt_lb_call_delta_mc_ci_low,
 SAFE_DOUBLE(opt_lb_call_delta_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -170,7 +527,7 @@ SAFE_DOUBLE(opt_lb_call_delta_mc_ci_high,
 SAFE_DOUBLE(opt_lb_call_delta_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -178,7 +535,7 @@ SAFE_DOUBLE(opt_lb_call_delta_mc_vr,
 SAFE_DOUBLE(opt_lb_call_delta_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -186,7 +543,7 @@ SAFE_DOUBLE(opt_lb_call_delta_mc_vr_se,
 SAFE_DOUBLE(opt_lb_call_delta_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -194,7 +551,7 @@ SAFE_DOUBLE(opt_lb_call_delta_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_call_delta_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -206,7 +563,7 @@ SAFE_DOUBLE(opt_lb_call_delta_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_call_gamma_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -214,7 +571,7 @@ SAFE_DOUBLE(opt_lb_call_gamma_mc,
 SAFE_DOUBLE(opt_lb_call_gamma_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -222,7 +579,7 @@ SAFE_DOUBLE(opt_lb_call_gamma_mc_se,
 SAFE_DOUBLE(opt_lb_call_gamma_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -230,7 +587,7 @@ SAFE_DOUBLE(opt_lb_call_gamma_mc_ci_low,
 SAFE_DOUBLE(opt_lb_call_gamma_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -238,7 +595,7 @@ SAFE_DOUBLE(opt_lb_call_gamma_mc_ci_high,
 SAFE_DOUBLE(opt_lb_call_gamma_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -246,7 +603,7 @@ SAFE_DOUBLE(opt_lb_call_gamma_mc_vr,
 SAFE_DOUBLE(opt_lb_call_gamma_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -254,7 +611,7 @@ SAFE_DOUBLE(opt_lb_call_gamma_mc_vr_se,
 SAFE_DOUBLE(opt_lb_call_gamma_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -262,7 +619,7 @@ SAFE_DOUBLE(opt_lb_call_gamma_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_call_gamma_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -274,7 +631,7 @@ SAFE_DOUBLE(opt_lb_call_gamma_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_call_theta_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -282,7 +639,7 @@ SAFE_DOUBLE(opt_lb_call_theta_mc,
 SAFE_DOUBLE(opt_lb_call_theta_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -290,7 +647,7 @@ SAFE_DOUBLE(opt_lb_call_theta_mc_se,
 SAFE_DOUBLE(opt_lb_call_theta_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -298,7 +655,7 @@ SAFE_DOUBLE(opt_lb_call_theta_mc_ci_low,
 SAFE_DOUBLE(opt_lb_call_theta_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -306,7 +663,7 @@ SAFE_DOUBLE(opt_lb_call_theta_mc_ci_high,
 SAFE_DOUBLE(opt_lb_call_theta_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -314,7 +671,7 @@ SAFE_DOUBLE(opt_lb_call_theta_mc_vr,
 SAFE_DOUBLE(opt_lb_call_theta_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -322,7 +679,7 @@ SAFE_DOUBLE(opt_lb_call_theta_mc_vr_se,
 SAFE_DOUBLE(opt_lb_call_theta_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -330,7 +687,7 @@ SAFE_DOUBLE(opt_lb_call_theta_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_call_theta_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -342,7 +699,7 @@ SAFE_DOUBLE(opt_lb_call_theta_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_call_rho_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -350,7 +707,7 @@ SAFE_DOUBLE(opt_lb_call_rho_mc,
 SAFE_DOUBLE(opt_lb_call_rho_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -358,7 +715,7 @@ SAFE_DOUBLE(opt_lb_call_rho_mc_se,
 SAFE_DOUBLE(opt_lb_call_rho_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -366,7 +723,7 @@ SAFE_DOUBLE(opt_lb_call_rho_mc_ci_low,
 SAFE_DOUBLE(opt_lb_call_rho_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -374,7 +731,7 @@ SAFE_DOUBLE(opt_lb_call_rho_mc_ci_high,
 SAFE_DOUBLE(opt_lb_call_rho_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -382,7 +739,7 @@ SAFE_DOUBLE(opt_lb_call_rho_mc_vr,
 SAFE_DOUBLE(opt_lb_call_rho_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -390,7 +747,7 @@ SAFE_DOUBLE(opt_lb_call_rho_mc_vr_se,
 SAFE_DOUBLE(opt_lb_call_rho_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -398,7 +755,7 @@ SAFE_DOUBLE(opt_lb_call_rho_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_call_rho_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -410,7 +767,7 @@ SAFE_DOUBLE(opt_lb_call_rho_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_call_vega_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -418,7 +775,7 @@ SAFE_DOUBLE(opt_lb_call_vega_mc,
 SAFE_DOUBLE(opt_lb_call_vega_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -426,7 +783,7 @@ SAFE_DOUBLE(opt_lb_call_vega_mc_se,
 SAFE_DOUBLE(opt_lb_call_vega_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -434,7 +791,7 @@ SAFE_DOUBLE(opt_lb_call_vega_mc_ci_low,
 SAFE_DOUBLE(opt_lb_call_vega_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -442,7 +799,7 @@ SAFE_DOUBLE(opt_lb_call_vega_mc_ci_high,
 SAFE_DOUBLE(opt_lb_call_vega_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -450,7 +807,7 @@ SAFE_DOUBLE(opt_lb_call_vega_mc_vr,
 SAFE_DOUBLE(opt_lb_call_vega_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -458,7 +815,7 @@ SAFE_DOUBLE(opt_lb_call_vega_mc_vr_se,
 SAFE_DOUBLE(opt_lb_call_vega_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -466,7 +823,7 @@ SAFE_DOUBLE(opt_lb_call_vega_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_call_vega_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackCall(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -482,6 +839,52 @@ SAFE_DOUBLE(opt_lb_call_price_bb_asymptotic,
     }
 )
 
+// ============================================================================
+//  LOOKBACK CALL — FORMULE FERMÉE (Goldman–Sosin–Gatto, surveillance continue)
+// ============================================================================
+
+SAFE_DOUBLE(opt_lb_call_price_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingCallAnalytic(S0, R, sigma, T0, T);
+    }
+)
+
+SAFE_DOUBLE(opt_lb_call_delta_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingCallRiskAnalytic(S0, R, sigma, T0, T).delta;
+    }
+)
+
+SAFE_DOUBLE(opt_lb_call_gamma_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingCallRiskAnalytic(S0, R, sigma, T0, T).gamma;
+    }
+)
+
+SAFE_DOUBLE(opt_lb_call_theta_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingCallRiskAnalytic(S0, R, sigma, T0, T).theta;
+    }
+)
+
+SAFE_DOUBLE(opt_lb_call_rho_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingCallRiskAnalytic(S0, R, sigma, T0, T).rho;
+    }
+)
+
+SAFE_DOUBLE(opt_lb_call_vega_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingCallRiskAnalytic(S0, R, sigma, T0, T).vega;
+    }
+)
+
 // ============================================================================
 //  LOOKBACK PUT — PRIX (MC standard)
 // ============================================================================
@@ -489,7 +892,7 @@ SAFE_DOUBLE(opt_lb_call_price_bb_asymptotic,
 SAFE_DOUBLE(opt_lb_put_price_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).priceMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -497,7 +900,7 @@ SAFE_DOUBLE(opt_lb_put_price_mc,
 SAFE_DOUBLE(opt_lb_put_price_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).priceMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -505,7 +908,7 @@ SAFE_DOUBLE(opt_lb_put_price_mc_se,
 SAFE_DOUBLE(opt_lb_put_price_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).priceMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -513,7 +916,7 @@ SAFE_DOUBLE(opt_lb_put_price_mc_ci_low,
 SAFE_DOUBLE(opt_lb_put_price_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).priceMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -525,7 +928,7 @@ SAFE_DOUBLE(opt_lb_put_price_mc_ci_high,
 SAFE_DOUBLE(opt_lb_put_price_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).priceMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -533,7 +936,7 @@ SAFE_DOUBLE(opt_lb_put_price_mc_vr,
 SAFE_DOUBLE(opt_lb_put_price_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).priceMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -541,7 +944,7 @@ SAFE_DOUBLE(opt_lb_put_price_mc_vr_se,
 SAFE_DOUBLE(opt_lb_put_price_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).priceMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -549,7 +952,7 @@ SAFE_DOUBLE(opt_lb_put_price_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_put_price_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).priceMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -561,7 +964,7 @@ SAFE_DOUBLE(opt_lb_put_price_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_put_delta_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -569,7 +972,7 @@ SAFE_DOUBLE(opt_lb_put_delta_mc,
 SAFE_DOUBLE(opt_lb_put_delta_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -577,7 +980,7 @@ SAFE_DOUBLE(opt_lb_put_delta_mc_se,
 SAFE_DOUBLE(opt_lb_put_delta_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -585,7 +988,7 @@ SAFE_DOUBLE(opt_lb_put_delta_mc_ci_low,
 SAFE_DOUBLE(opt_lb_put_delta_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -593,7 +996,7 @@ SAFE_DOUBLE(opt_lb_put_delta_mc_ci_high,
 SAFE_DOUBLE(opt_lb_put_delta_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -601,7 +1004,7 @@ SAFE_DOUBLE(opt_lb_put_delta_mc_vr,
 SAFE_DOUBLE(opt_lb_put_delta_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -609,7 +1012,7 @@ SAFE_DOUBLE(opt_lb_put_delta_mc_vr_se,
 SAFE_DOUBLE(opt_lb_put_delta_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -617,7 +1020,7 @@ SAFE_DOUBLE(opt_lb_put_delta_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_put_delta_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).deltaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -629,7 +1032,7 @@ SAFE_DOUBLE(opt_lb_put_delta_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_put_gamma_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -637,7 +1040,7 @@ SAFE_DOUBLE(opt_lb_put_gamma_mc,
 SAFE_DOUBLE(opt_lb_put_gamma_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -645,7 +1048,7 @@ SAFE_DOUBLE(opt_lb_put_gamma_mc_se,
 SAFE_DOUBLE(opt_lb_put_gamma_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -653,7 +1056,7 @@ SAFE_DOUBLE(opt_lb_put_gamma_mc_ci_low,
 SAFE_DOUBLE(opt_lb_put_gamma_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -661,7 +1064,7 @@ SAFE_DOUBLE(opt_lb_put_gamma_mc_ci_high,
 SAFE_DOUBLE(opt_lb_put_gamma_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -669,7 +1072,7 @@ SAFE_DOUBLE(opt_lb_put_gamma_mc_vr,
 SAFE_DOUBLE(opt_lb_put_gamma_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -677,7 +1080,7 @@ SAFE_DOUBLE(opt_lb_put_gamma_mc_vr_se,
 SAFE_DOUBLE(opt_lb_put_gamma_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -685,7 +1088,7 @@ SAFE_DOUBLE(opt_lb_put_gamma_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_put_gamma_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).gammaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -697,7 +1100,7 @@ SAFE_DOUBLE(opt_lb_put_gamma_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_put_theta_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -705,7 +1108,7 @@ SAFE_DOUBLE(opt_lb_put_theta_mc,
 SAFE_DOUBLE(opt_lb_put_theta_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -713,7 +1116,7 @@ SAFE_DOUBLE(opt_lb_put_theta_mc_se,
 SAFE_DOUBLE(opt_lb_put_theta_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -721,7 +1124,7 @@ SAFE_DOUBLE(opt_lb_put_theta_mc_ci_low,
 SAFE_DOUBLE(opt_lb_put_theta_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -729,7 +1132,7 @@ SAFE_DOUBLE(opt_lb_put_theta_mc_ci_high,
 SAFE_DOUBLE(opt_lb_put_theta_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -737,7 +1140,7 @@ SAFE_DOUBLE(opt_lb_put_theta_mc_vr,
 SAFE_DOUBLE(opt_lb_put_theta_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -745,7 +1148,7 @@ SAFE_DOUBLE(opt_lb_put_theta_mc_vr_se,
 SAFE_DOUBLE(opt_lb_put_theta_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -753,7 +1156,7 @@ SAFE_DOUBLE(opt_lb_put_theta_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_put_theta_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).thetaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -765,7 +1168,7 @@ SAFE_DOUBLE(opt_lb_put_theta_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_put_rho_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -773,7 +1176,7 @@ SAFE_DOUBLE(opt_lb_put_rho_mc,
 SAFE_DOUBLE(opt_lb_put_rho_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -781,7 +1184,7 @@ SAFE_DOUBLE(opt_lb_put_rho_mc_se,
 SAFE_DOUBLE(opt_lb_put_rho_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -789,7 +1192,7 @@ SAFE_DOUBLE(opt_lb_put_rho_mc_ci_low,
 SAFE_DOUBLE(opt_lb_put_rho_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -797,7 +1200,7 @@ SAFE_DOUBLE(opt_lb_put_rho_mc_ci_high,
 SAFE_DOUBLE(opt_lb_put_rho_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -805,7 +1208,7 @@ SAFE_DOUBLE(opt_lb_put_rho_mc_vr,
 SAFE_DOUBLE(opt_lb_put_rho_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -813,7 +1216,7 @@ SAFE_DOUBLE(opt_lb_put_rho_mc_vr_se,
 SAFE_DOUBLE(opt_lb_put_rho_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -821,7 +1224,7 @@ SAFE_DOUBLE(opt_lb_put_rho_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_put_rho_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).rhoMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -833,7 +1236,7 @@ SAFE_DOUBLE(opt_lb_put_rho_mc_vr_ci_high,
 SAFE_DOUBLE(opt_lb_put_vega_mc,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.estimate;
     }
 )
@@ -841,7 +1244,7 @@ SAFE_DOUBLE(opt_lb_put_vega_mc,
 SAFE_DOUBLE(opt_lb_put_vega_mc_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.stdError;
     }
 )
@@ -849,7 +1252,7 @@ SAFE_DOUBLE(opt_lb_put_vega_mc_se,
 SAFE_DOUBLE(opt_lb_put_vega_mc_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciLow;
     }
 )
@@ -857,7 +1260,7 @@ SAFE_DOUBLE(opt_lb_put_vega_mc_ci_low,
 SAFE_DOUBLE(opt_lb_put_vega_mc_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, false);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false);
         return stats.ciHigh;
     }
 )
@@ -865,7 +1268,7 @@ SAFE_DOUBLE(opt_lb_put_vega_mc_ci_high,
 SAFE_DOUBLE(opt_lb_put_vega_mc_vr,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.estimate;
     }
 )
@@ -873,7 +1276,7 @@ SAFE_DOUBLE(opt_lb_put_vega_mc_vr,
 SAFE_DOUBLE(opt_lb_put_vega_mc_vr_se,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.stdError;
     }
 )
@@ -881,7 +1284,7 @@ SAFE_DOUBLE(opt_lb_put_vega_mc_vr_se,
 SAFE_DOUBLE(opt_lb_put_vega_mc_vr_ci_low,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciLow;
     }
 )
@@ -889,7 +1292,7 @@ SAFE_DOUBLE(opt_lb_put_vega_mc_vr_ci_low,
 SAFE_DOUBLE(opt_lb_put_vega_mc_vr_ci_high,
     (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed),
     {
-        auto stats = makeLookbackPut(S0, R, sigma, T0, T).vegaMC(paths, steps, seed, true);
+        auto stats = cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true);
         return stats.ciHigh;
     }
 )
@@ -904,3 +1307,449 @@ SAFE_DOUBLE(opt_lb_put_price_bb_asymptotic,
         return makeLookbackPut(S0, R, sigma, T0, T).priceMC_BrownianBridge_Asymptotic();
     }
 )
+
+// ============================================================================
+//  LOOKBACK PUT — FORMULE FERMÉE (Goldman–Sosin–Gatto, surveillance continue)
+// ============================================================================
+
+SAFE_DOUBLE(opt_lb_put_price_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingPutAnalytic(S0, R, sigma, T0, T);
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_delta_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingPutRiskAnalytic(S0, R, sigma, T0, T).delta;
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_gamma_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingPutRiskAnalytic(S0, R, sigma, T0, T).gamma;
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_theta_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingPutRiskAnalytic(S0, R, sigma, T0, T).theta;
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_rho_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingPutRiskAnalytic(S0, R, sigma, T0, T).rho;
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_vega_analytic,
+    (double S0, double R, double sigma, double T0, double T),
+    {
+        return opt::lookbackFloatingPutRiskAnalytic(S0, R, sigma, T0, T).vega;
+    }
+)
+
+// ============================================================================
+//  LOOKBACK CALL — RÉSULTAT COMPLET (une simulation : estimateur, SE, IC 95%)
+// ============================================================================
+
+SAFE_STATS(opt_lb_call_price_mc_full, cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_call_price_mc_vr_full, cachedLookbackCall(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_call_delta_mc_full, cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_call_delta_mc_vr_full, cachedLookbackCall(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_call_gamma_mc_full, cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_call_gamma_mc_vr_full, cachedLookbackCall(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_call_theta_mc_full, cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_call_theta_mc_vr_full, cachedLookbackCall(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_call_rho_mc_full, cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_call_rho_mc_vr_full, cachedLookbackCall(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_call_vega_mc_full, cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_call_vega_mc_vr_full, cachedLookbackCall(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true))
+
+// ============================================================================
+//  LOOKBACK PUT — RÉSULTAT COMPLET (une simulation : estimateur, SE, IC 95%)
+// ============================================================================
+
+SAFE_STATS(opt_lb_put_price_mc_full, cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_put_price_mc_vr_full, cachedLookbackPut(opt::CachedQuantity::Price, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_put_delta_mc_full, cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_put_delta_mc_vr_full, cachedLookbackPut(opt::CachedQuantity::Delta, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_put_gamma_mc_full, cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_put_gamma_mc_vr_full, cachedLookbackPut(opt::CachedQuantity::Gamma, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_put_theta_mc_full, cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_put_theta_mc_vr_full, cachedLookbackPut(opt::CachedQuantity::Theta, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_put_rho_mc_full, cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_put_rho_mc_vr_full, cachedLookbackPut(opt::CachedQuantity::Rho, S0, R, sigma, T0, T, paths, steps, seed, true))
+SAFE_STATS(opt_lb_put_vega_mc_full, cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, false))
+SAFE_STATS(opt_lb_put_vega_mc_vr_full, cachedLookbackPut(opt::CachedQuantity::Vega, S0, R, sigma, T0, T, paths, steps, seed, true))
+
+// ============================================================================
+//  LOOKBACK CALL/PUT — PRIX + GRECQUES (une seule passe sur les trajectoires)
+// ============================================================================
+
+SAFE_DOUBLE(opt_lb_call_risk_mc,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, double* out),
+    {
+        return writeRisk(out, makeLookbackCall(S0, R, sigma, T0, T).riskMC(paths, steps, seed, false));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_call_risk_mc_vr,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, double* out),
+    {
+        return writeRisk(out, makeLookbackCall(S0, R, sigma, T0, T).riskMC(paths, steps, seed, true));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_risk_mc,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, double* out),
+    {
+        return writeRisk(out, makeLookbackPut(S0, R, sigma, T0, T).riskMC(paths, steps, seed, false));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_risk_mc_vr,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, double* out),
+    {
+        return writeRisk(out, makeLookbackPut(S0, R, sigma, T0, T).riskMC(paths, steps, seed, true));
+    }
+)
+
+// ============================================================================
+//  LOOKBACK CALL/PUT — SURVEILLANCE CONTINUE (correction de pont brownien)
+// ============================================================================
+
+SAFE_STATS(opt_lb_call_price_mc_bb_full,
+    withBridgeCorrection(makeLookbackCall(S0, R, sigma, T0, T)).priceMC(paths, steps, seed, false))
+SAFE_STATS(opt_lb_call_price_mc_vr_bb_full,
+    withBridgeCorrection(makeLookbackCall(S0, R, sigma, T0, T)).priceMC(paths, steps, seed, true))
+SAFE_STATS(opt_lb_put_price_mc_bb_full,
+    withBridgeCorrection(makeLookbackPut(S0, R, sigma, T0, T)).priceMC(paths, steps, seed, false))
+SAFE_STATS(opt_lb_put_price_mc_vr_bb_full,
+    withBridgeCorrection(makeLookbackPut(S0, R, sigma, T0, T)).priceMC(paths, steps, seed, true))
+
+SAFE_DOUBLE(opt_lb_call_risk_mc_bb,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, double* out),
+    {
+        return writeRisk(out, withBridgeCorrection(makeLookbackCall(S0, R, sigma, T0, T)).riskMC(paths, steps, seed, false));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_call_risk_mc_vr_bb,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, double* out),
+    {
+        return writeRisk(out, withBridgeCorrection(makeLookbackCall(S0, R, sigma, T0, T)).riskMC(paths, steps, seed, true));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_risk_mc_bb,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, double* out),
+    {
+        return writeRisk(out, withBridgeCorrection(makeLookbackPut(S0, R, sigma, T0, T)).riskMC(paths, steps, seed, false));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_risk_mc_vr_bb,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed, double* out),
+    {
+        return writeRisk(out, withBridgeCorrection(makeLookbackPut(S0, R, sigma, T0, T)).riskMC(paths, steps, seed, true));
+    }
+)
+
+// ============================================================================
+//  LOOKBACK À STRIKE FIXE (call : max - K, put : K - min)
+// ============================================================================
+
+SAFE_DOUBLE(opt_lb_fixed_call_price_mc,
+    (double S0, double R, double sigma, double T0, double T, double K, int paths, int steps, std::uint64_t seed,
+        int antithetic, double* out),
+    {
+        prepareStats(out);
+        return writeStats(out, makeFixedLookbackCall(S0, R, sigma, T0, T, K).priceMC(paths, steps, seed, antithetic != 0));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_fixed_put_price_mc,
+    (double S0, double R, double sigma, double T0, double T, double K, int paths, int steps, std::uint64_t seed,
+        int antithetic, double* out),
+    {
+        prepareStats(out);
+        return writeStats(out, makeFixedLookbackPut(S0, R, sigma, T0, T, K).priceMC(paths, steps, seed, antithetic != 0));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_fixed_call_risk_mc,
+    (double S0, double R, double sigma, double T0, double T, double K, int paths, int steps, std::uint64_t seed,
+        int antithetic, int greeks, double* out),
+    {
+        return writeRisk(out, withGreekMethod(makeFixedLookbackCall(S0, R, sigma, T0, T, K), greeks)
+            .riskMC(paths, steps, seed, antithetic != 0));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_fixed_put_risk_mc,
+    (double S0, double R, double sigma, double T0, double T, double K, int paths, int steps, std::uint64_t seed,
+        int antithetic, int greeks, double* out),
+    {
+        return writeRisk(out, withGreekMethod(makeFixedLookbackPut(S0, R, sigma, T0, T, K), greeks)
+            .riskMC(paths, steps, seed, antithetic != 0));
+    }
+)
+
+// ============================================================================
+//  LOOKBACK CALL/PUT — PRIX À PRÉCISION CIBLE (arrêt sur SE, plafond de trajectoires, budget de temps)
+// ============================================================================
+
+SAFE_DOUBLE(opt_lb_call_price_mc_adaptive,
+    (double S0, double R, double sigma, double T0, double T, double targetSE, int maxPaths, double maxSeconds,
+        int steps, std::uint64_t seed, double* out),
+    {
+        return writeAdaptive(out, makeLookbackCall(S0, R, sigma, T0, T).priceMCAdaptive(targetSE, maxPaths, maxSeconds,
+            steps, seed, false));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_call_price_mc_vr_adaptive,
+    (double S0, double R, double sigma, double T0, double T, double targetSE, int maxPaths, double maxSeconds,
+        int steps, std::uint64_t seed, double* out),
+    {
+        return writeAdaptive(out, makeLookbackCall(S0, R, sigma, T0, T).priceMCAdaptive(targetSE, maxPaths, maxSeconds,
+            steps, seed, true));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_price_mc_adaptive,
+    (double S0, double R, double sigma, double T0, double T, double targetSE, int maxPaths, double maxSeconds,
+        int steps, std::uint64_t seed, double* out),
+    {
+        return writeAdaptive(out, makeLookbackPut(S0, R, sigma, T0, T).priceMCAdaptive(targetSE, maxPaths, maxSeconds,
+            steps, seed, false));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_price_mc_vr_adaptive,
+    (double S0, double R, double sigma, double T0, double T, double targetSE, int maxPaths, double maxSeconds,
+        int steps, std::uint64_t seed, double* out),
+    {
+        return writeAdaptive(out, makeLookbackPut(S0, R, sigma, T0, T).priceMCAdaptive(targetSE, maxPaths, maxSeconds,
+            steps, seed, true));
+    }
+)
+
+// ============================================================================
+//  LOOKBACK CALL/PUT — PRIX MONTE CARLO MULTI-NIVEAUX (MLMC)
+// ============================================================================
+
+SAFE_DOUBLE(opt_lb_call_price_mlmc,
+    (double S0, double R, double sigma, double T0, double T, double targetRMSE, int steps, std::uint64_t seed,
+        double* out),
+    {
+        return writeMultilevel(out, makeLookbackCall(S0, R, sigma, T0, T).priceMLMC(targetRMSE, steps, seed, false));
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_price_mlmc,
+    (double S0, double R, double sigma, double T0, double T, double targetRMSE, int steps, std::uint64_t seed,
+        double* out),
+    {
+        return writeMultilevel(out, makeLookbackPut(S0, R, sigma, T0, T).priceMLMC(targetRMSE, steps, seed, false));
+    }
+)
+
+// ============================================================================
+//  LOOKBACK CALL/PUT — ÉCHELLE SPOT x VOLATILITÉ (tirages communs à tous les points)
+// ============================================================================
+
+SAFE_DOUBLE(opt_lb_call_ladder_mc,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed,
+        int antithetic, int nSpot, const double* spotShifts, int nVol, const double* volShifts,
+        double* price, double* priceSE),
+    {
+        return writeLadder(makeLookbackCall(S0, R, sigma, T0, T), paths, steps, seed, antithetic,
+            nSpot, spotShifts, nVol, volShifts, price, priceSE);
+    }
+)
+
+SAFE_DOUBLE(opt_lb_put_ladder_mc,
+    (double S0, double R, double sigma, double T0, double T, int paths, int steps, std::uint64_t seed,
+        int antithetic, int nSpot, const double* spotShifts, int nVol, const double* volShifts,
+        double* price, double* priceSE),
+    {
+        return writeLadder(makeLookbackPut(S0, R, sigma, T0, T), paths, steps, seed, antithetic,
+            nSpot, spotShifts, nVol, volShifts, price, priceSE);
+    }
+)
+
+// ============================================================================
+//  PORTEFEUILLE DE LOOKBACKS (tableaux SoA, tirages partagés, paquets en parallèle)
+// ============================================================================
+
+SAFE_DOUBLE(opt_lb_portfolio_mc,
+    (int count, const double* S0, const double* R, const double* sigma, const double* T0, const double* T,
+        const int* type, int paths, int steps, std::uint64_t seed, int antithetic, int threads,
+        double* price, double* priceSE, double* delta, double* deltaSE, double* gamma, double* gammaSE,
+        double* theta, double* thetaSE, double* rho, double* rhoSE, double* vega, double* vegaSE),
+    {
+        opt::LookbackPortfolio portfolio;
+        portfolio.count = count;
+        portfolio.S0 = S0;
+        portfolio.R = R;
+        portfolio.sigma = sigma;
+        portfolio.T0 = T0;
+        portfolio.T = T;
+        portfolio.type = type;
+
+        opt::LookbackPortfolioResults results;
+        results.price = price;
+        results.priceSE = priceSE;
+        results.delta = delta;
+        results.deltaSE = deltaSE;
+        results.gamma = gamma;
+        results.gammaSE = gammaSE;
+        results.theta = theta;
+        results.thetaSE = thetaSE;
+        results.rho = rho;
+        results.rhoSE = rhoSE;
+        results.vega = vega;
+        results.vegaSE = vegaSE;
+
+        opt::MCConfig config;
+        config.threads = threads;
+
+        return static_cast<double>(opt::priceLookbackPortfolio(portfolio, paths, steps, seed, antithetic != 0,
+            config, opt::RiskBumps(), results));
+    }
+)
+
+// ============================================================================
+//  CALCUL ASYNCHRONE (soumission, interrogation, collecte)
+// ============================================================================
+
+SAFE_DOUBLE(opt_async_lb_submit,
+    (int type, int measure, double S0, double R, double sigma, double T0, double T, int paths, int steps,
+        std::uint64_t seed, int antithetic),
+    {
+        if (measure != 0 && measure != 1) throw std::invalid_argument("measure : 0 (prix) ou 1 (prix + grecques).");
+
+        opt::LookbackJob job;
+        job.type = static_cast<opt::LookbackType>(type);
+        job.measure = static_cast<opt::JobMeasure>(measure);
+        job.S0 = S0;
+        job.R = R;
+        job.sigma = sigma;
+        job.T0 = T0;
+        job.T = T;
+        job.paths = paths;
+        job.steps = steps;
+        job.seed = seed;
+        job.antithetic = antithetic != 0;
+        job.config = exportConfig();
+
+        return static_cast<double>(opt::AsyncPricer::instance().submit(job));
+    }
+)
+
+SAFE_DOUBLE(opt_async_status,
+    (double id),
+    {
+        return static_cast<double>(opt::AsyncPricer::instance().status(static_cast<std::int64_t>(id)));
+    }
+)
+
+SAFE_DOUBLE(opt_async_collect,
+    (double id, double* out, int size),
+    {
+        if (out == nullptr || size <= 0) throw std::invalid_argument("Tampon de sortie nul.");
+
+        // Tampon vérifié avant collect, qui libère le job : trop petit, le job reste collectable
+        opt::AsyncPricer& pricer = opt::AsyncPricer::instance();
+        const std::int64_t job = static_cast<std::int64_t>(id);
+        const std::size_t needed = pricer.resultSize(job);
+        if (needed > static_cast<std::size_t>(size))
+            throw std::invalid_argument("Tampon trop petit : " + std::to_string(needed) + " doubles requis.");
+
+        std::vector<double> result;
+        std::string error;
+        switch (pricer.collect(job, result, error)) {
+        case opt::JobStatus::Done:
+            std::copy(result.begin(), result.end(), out);
+            return result.empty() ? std::nan("") : result[0];
+        case opt::JobStatus::Failed:
+            throw std::runtime_error(error);
+        case opt::JobStatus::Unknown:
+            throw std::invalid_argument("Job inconnu, déjà collecté ou évincé.");
+        default:
+            return std::nan("");
+        }
+    }
+)
+
+SAFE_DOUBLE(opt_async_cancel,
+    (double id),
+    {
+        return opt::AsyncPricer::instance().cancel(static_cast<std::int64_t>(id)) ? 1.0 : 0.0;
+    }
+)
+
+SAFE_DOUBLE(opt_async_set_max_finished,
+    (int maxFinished),
+    {
+        if (maxFinished < 0) throw std::invalid_argument("maxFinished doit être >= 0.");
+        opt::AsyncPricer::instance().setMaxFinished(static_cast<std::size_t>(maxFinished));
+        return static_cast<double>(maxFinished);
+    }
+)
+
+// ============================================================================
+//  CACHE DES RÉSULTATS MC (statistiques, capacité)
+// ============================================================================
+
+SAFE_DOUBLE(opt_cache_hits, (), { return static_cast<double>(opt::ResultCache::instance().hits()); })
+
+SAFE_DOUBLE(opt_cache_misses, (), { return static_cast<double>(opt::ResultCache::instance().misses()); })
+
+SAFE_DOUBLE(opt_cache_size, (), { return static_cast<double>(opt::ResultCache::instance().size()); })
+
+SAFE_DOUBLE(opt_cache_set_capacity,
+    (int capacity),
+    {
+        if (capacity < 0) throw std::invalid_argument("capacity doit être >= 0.");
+        opt::ResultCache::instance().setCapacity(static_cast<std::size_t>(capacity));
+        return static_cast<double>(capacity);
+    }
+)
+
+// ============================================================================
+//  ERREURS (dernière erreur du thread appelant, boîte de dialogue optionnelle)
+// ============================================================================
+
+extern "C" int OPT_CALL opt_last_error_code()
+{
+    return t_lastError.code;
+}
+
+extern "C" int OPT_CALL opt_last_error_message(char* buffer, int size)
+{
+    return copyErrorText(t_lastError.message, buffer, size);
+}
+
+extern "C" int OPT_CALL opt_last_error_source(char* buffer, int size)
+{
+    return copyErrorText(t_lastError.source, buffer, size);
+}
+
+extern "C" void OPT_CALL opt_clear_last_error()
+{
+    clearLastError();
+}
+
+extern "C" void OPT_CALL opt_set_error_dialog(int enabled)
+{
+    g_errorDialog = (enabled != 0);
+    g_errorDisplayed = false;
+}
@@ -5,10 +5,30 @@
 #include "Aggregator.h"
 #include "Option.h"
 #include "Asian.h"
+#include "Analytic.h"
+#include "Portfolio.h"
+#include "AsyncPricer.h"
+#include "ResultCache.h"
+
+#ifdef _WIN32
+#include <OleAuto.h>
+#endif
+
+/**
+ * @brief Exports du C ABI : DLL __stdcall sous Windows, symboles visibles (-fvisibility=hidden
+ * pour le reste) d'une bibliothèque partagée ailleurs.
+ */
+#if defined(_WIN32)
+#define OPT_API __declspec(dllexport)
+#define OPT_CALL __stdcall
+#else
+#define OPT_API __attribute__((visibility("default")))
+#define OPT_CALL
+#endif
 
 /**
  * @file Exports.h
- * @brief Interface C (DLL) pour Excel/VBA – options lookback (floating strike).
+ * @brief Interface C (DLL) pour Excel/VBA – options lookback (strike flottant, strike fixe).
  *
  * Conventions :
  * - Interface "extern C" pour compatibilité VBA.
@@ -17,368 +37,806 @@
  *   (2) MC avec réduction de variance (variables antithétiques) : suffixe _mc_vr
  * - Pour chaque grandeur (prix, grecques) on expose :
  *   estimateur, erreur standard, borne basse IC, borne haute IC.
+ * - Variantes "résultat complet" (suffixe _full) : une seule simulation remplit
+ *   les quatre statistiques, dans l'ordre (estimateur, SE, IC bas, IC haut) :
+ *   - name(..., double* out)         : tampon de 4 doubles fourni par l'appelant ;
+ *   - name_xl(..., SAFEARRAY** out)  : tableau VBA dynamique (Dim r() As Double),
+ *     à renvoyer tel quel par une UDF saisie en formule matricielle (1 x 4) ; Windows
+ *     uniquement.
+ *   La valeur de retour est l'estimateur (NaN en cas d'erreur).
+ * - Erreurs : un export en échec renvoie NaN et renseigne la dernière erreur du thread
+ *   appelant (opt_last_error_*), remise à OPT_OK à chaque appel. Aucune boîte de dialogue
+ *   par défaut (appels concurrents, serveurs sans affichage) : voir opt_set_error_dialog.
+ * - Suffixe _analytic : formule fermée en surveillance continue (pas de paths/steps/seed),
+ *   limite steps -> infini des prix Monte Carlo.
  */
 
 extern "C" {
 
+    /**
+     * @brief Codes de la dernière erreur (opt_last_error_code).
+     */
+    enum OptErrorCode {
+        OPT_OK = 0,                    ///< Dernier appel réussi.
+        OPT_ERR_INVALID_ARGUMENT = 1,  ///< Paramètre invalide (std::invalid_argument).
+        OPT_ERR_RUNTIME = 2,           ///< Échec du calcul (autre std::exception, job asynchrone en erreur).
+        OPT_ERR_OUT_OF_MEMORY = 3,     ///< Allocation impossible.
+        OPT_ERR_UNKNOWN = 4            ///< Exception non standard.
+    };
+
     // ============================================================================
     //  LOOKBACK CALL — PRIX (MC standard)
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_call_price_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_price_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_price_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_price_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK CALL — PRIX (MC VR : antithétiques)
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_call_price_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_price_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_price_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_price_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK CALL — DELTA (MC standard/VR) 
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_call_delta_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_delta_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_delta_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_delta_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_delta_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_delta_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_delta_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_delta_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_delta_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_delta_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_delta_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_delta_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_delta_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_delta_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_delta_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_delta_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK CALL — GAMMA (MC standard/VR)
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_call_gamma_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_gamma_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_gamma_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_gamma_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_gamma_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_gamma_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_gamma_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_gamma_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_gamma_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_gamma_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_gamma_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_gamma_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_gamma_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_gamma_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_gamma_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_gamma_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK CALL — THETA (MC standard/VR)
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_call_theta_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_theta_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_theta_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_theta_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_theta_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_theta_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_theta_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_theta_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_theta_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_theta_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_theta_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_theta_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_theta_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_theta_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_theta_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_theta_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK CALL — RHO (MC standard/VR) 
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_call_rho_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_rho_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_rho_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_rho_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_rho_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_rho_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_rho_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_rho_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_rho_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_rho_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_rho_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_rho_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_rho_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_rho_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_rho_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_rho_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK CALL — VEGA (MC standard/VR) 
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_call_vega_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_vega_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_vega_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_vega_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_vega_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_vega_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_vega_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_vega_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_vega_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_vega_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_vega_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_vega_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_vega_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_vega_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_call_vega_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_vega_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK CALL — PRIX ASYMPTOTIQUE (Brownian Bridge, LOOKBACK ONLY)
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_call_price_bb_asymptotic(double S0, double R, double sigma,
+    OPT_API double opt_lb_call_price_bb_asymptotic(double S0, double R, double sigma,
+        double T0, double T);
+
+    // ============================================================================
+    //  LOOKBACK CALL — FORMULE FERMÉE (Goldman–Sosin–Gatto, surveillance continue)
+    // ============================================================================
+
+    OPT_API double opt_lb_call_price_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_call_delta_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_call_gamma_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_call_theta_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_call_rho_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_call_vega_analytic(double S0, double R, double sigma,
         double T0, double T);
 
     // ============================================================================
     //  LOOKBACK PUT — PRIX (MC standard)
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_put_price_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_price_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_price_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_price_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK PUT — PRIX (MC VR : antithétiques)
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_put_price_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_price_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_price_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_price_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK PUT — DELTA (MC standard/VR) 
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_put_delta_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_delta_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_delta_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_delta_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_delta_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_delta_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_delta_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_delta_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_delta_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_delta_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_delta_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_delta_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_delta_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_delta_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_delta_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_delta_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK PUT — GAMMA (MC standard/VR) 
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_put_gamma_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_gamma_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_gamma_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_gamma_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_gamma_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_gamma_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_gamma_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_gamma_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_gamma_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_gamma_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_gamma_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_gamma_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_gamma_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_gamma_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_gamma_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_gamma_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK PUT — THETA (MC standard/VR) 
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_put_theta_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_theta_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_theta_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_theta_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_theta_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_theta_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_theta_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_theta_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_theta_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_theta_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_theta_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_theta_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_theta_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_theta_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_theta_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_theta_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK PUT — RHO (MC standard/VR) 
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_put_rho_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_rho_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_rho_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_rho_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_rho_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_rho_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_rho_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_rho_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_rho_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_rho_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_rho_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_rho_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_rho_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_rho_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_rho_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_rho_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK PUT — VEGA (MC standard/VR) 
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_put_vega_mc(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_vega_mc(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_vega_mc_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_vega_mc_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_vega_mc_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_vega_mc_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_vega_mc_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_vega_mc_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_vega_mc_vr(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_vega_mc_vr(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_vega_mc_vr_se(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_vega_mc_vr_se(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_vega_mc_vr_ci_low(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_vega_mc_vr_ci_low(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
-    __declspec(dllexport) double opt_lb_put_vega_mc_vr_ci_high(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_vega_mc_vr_ci_high(double S0, double R, double sigma,
         double T0, double T, int paths, int steps, std::uint64_t seed);
 
     // ============================================================================
     //  LOOKBACK PUT — PRIX ASYMPTOTIQUE (Brownian Bridge, LOOKBACK ONLY)
     // ============================================================================
 
-    __declspec(dllexport) double opt_lb_put_price_bb_asymptotic(double S0, double R, double sigma,
+    OPT_API double opt_lb_put_price_bb_asymptotic(double S0, double R, double sigma,
+        double T0, double T);
+
+    // ============================================================================
+    //  LOOKBACK PUT — FORMULE FERMÉE (Goldman–Sosin–Gatto, surveillance continue)
+    // ============================================================================
+
+    OPT_API double opt_lb_put_price_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_put_delta_analytic(double S0, double R, double sigma,
         double T0, double T);
 
+    OPT_API double opt_lb_put_gamma_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_put_theta_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_put_rho_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    OPT_API double opt_lb_put_vega_analytic(double S0, double R, double sigma,
+        double T0, double T);
+
+    // ============================================================================
+    //  LOOKBACK CALL — RÉSULTAT COMPLET (une simulation : estimateur, SE, IC 95%)
+    // ============================================================================
+
+    OPT_API double opt_lb_call_price_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_price_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_delta_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_delta_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_gamma_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_gamma_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_theta_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_theta_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_rho_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_rho_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_vega_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_vega_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    // ============================================================================
+    //  LOOKBACK PUT — RÉSULTAT COMPLET (une simulation : estimateur, SE, IC 95%)
+    // ============================================================================
+
+    OPT_API double opt_lb_put_price_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_price_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_delta_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_delta_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_gamma_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_gamma_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_theta_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_theta_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_rho_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_rho_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_vega_mc_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_vega_mc_vr_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    // ============================================================================
+    //  LOOKBACK CALL/PUT — PRIX + GRECQUES (une seule passe sur les trajectoires)
+    //  out : 24 doubles = (prix, delta, gamma, theta, rho, vega) x (estimateur, SE, IC bas, IC haut)
+    // ============================================================================
+
+    OPT_API double opt_lb_call_risk_mc(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_risk_mc_vr(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_risk_mc(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_risk_mc_vr(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    // ============================================================================
+    //  LOOKBACK CALL/PUT — SURVEILLANCE CONTINUE (correction de pont brownien)
+    //  Extrême continu tiré exactement sur chaque pas : quelques dizaines de pas suffisent.
+    //  _full : out = 4 doubles (estimateur, SE, IC bas, IC haut), _full_xl : tableau VBA (Windows) ;
+    //  _risk : out = 12 doubles
+    //  (comme opt_lb_call_risk_mc).
+    // ============================================================================
+
+    OPT_API double opt_lb_call_price_mc_bb_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_price_mc_vr_bb_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_price_mc_bb_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_price_mc_vr_bb_full(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_risk_mc_bb(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_risk_mc_vr_bb(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_risk_mc_bb(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_risk_mc_vr_bb(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, double* out);
+
+    // ============================================================================
+    //  LOOKBACK À STRIKE FIXE (call : max(max S - K, 0), put : max(K - min S, 0))
+    //  _price_mc : out = 4 doubles (estimateur, SE, IC bas, IC haut) ;
+    //  _risk_mc : out = 24 doubles (comme opt_lb_call_risk_mc), greeks : 0 = différences finies,
+    //  1 = pathwise, 2 = adjoint (gamma : différence centrée des deltas pathwise, payoff non
+    //  homogène en S0). antithetic : 0 / 1. Strike négatif ou non fini : erreur.
+    // ============================================================================
+
+    OPT_API double opt_lb_fixed_call_price_mc(double S0, double R, double sigma, double T0, double T,
+        double K, int paths, int steps, std::uint64_t seed, int antithetic, double* out);
+
+    OPT_API double opt_lb_fixed_put_price_mc(double S0, double R, double sigma, double T0, double T,
+        double K, int paths, int steps, std::uint64_t seed, int antithetic, double* out);
+
+    OPT_API double opt_lb_fixed_call_risk_mc(double S0, double R, double sigma, double T0, double T,
+        double K, int paths, int steps, std::uint64_t seed, int antithetic, int greeks, double* out);
+
+    OPT_API double opt_lb_fixed_put_risk_mc(double S0, double R, double sigma, double T0, double T,
+        double K, int paths, int steps, std::uint64_t seed, int antithetic, int greeks, double* out);
+
+    // ============================================================================
+    //  LOOKBACK CALL/PUT — PRIX À PRÉCISION CIBLE
+    //  Simule par tranches jusqu'à SE <= targetSE, maxPaths trajectoires ou maxSeconds secondes
+    //  (0 : pas de limite de temps).
+    //  out : 5 doubles = (estimateur, SE, IC bas, IC haut, trajectoires simulées)
+    // ============================================================================
+
+    OPT_API double opt_lb_call_price_mc_adaptive(double S0, double R, double sigma,
+        double T0, double T, double targetSE, int maxPaths, double maxSeconds, int steps,
+        std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_call_price_mc_vr_adaptive(double S0, double R, double sigma,
+        double T0, double T, double targetSE, int maxPaths, double maxSeconds, int steps,
+        std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_price_mc_adaptive(double S0, double R, double sigma,
+        double T0, double T, double targetSE, int maxPaths, double maxSeconds, int steps,
+        std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_price_mc_vr_adaptive(double S0, double R, double sigma,
+        double T0, double T, double targetSE, int maxPaths, double maxSeconds, int steps,
+        std::uint64_t seed, double* out);
+
+    // ============================================================================
+    //  LOOKBACK CALL/PUT — PRIX MONTE CARLO MULTI-NIVEAUX (MLMC)
+    //  Niveaux steps / 2^l couplés, trajectoires par niveau choisies pour atteindre targetRMSE.
+    //  Cible : le prix du lookback observé sur les steps dates (comme _price_mc), et non le
+    //  prix à surveillance continue de _price_analytic / _price_bb_asymptotic (biais de
+    //  discrétisation non corrigé).
+    //  out : 6 doubles = (estimateur, SE, IC bas, IC haut, coût en trajectoires à steps pas,
+    //  pas du niveau le plus grossier)
+    // ============================================================================
+
+    OPT_API double opt_lb_call_price_mlmc(double S0, double R, double sigma,
+        double T0, double T, double targetRMSE, int steps, std::uint64_t seed, double* out);
+
+    OPT_API double opt_lb_put_price_mlmc(double S0, double R, double sigma,
+        double T0, double T, double targetRMSE, int steps, std::uint64_t seed, double* out);
+
+    // ============================================================================
+    //  LOOKBACK CALL/PUT — ÉCHELLE SPOT x VOLATILITÉ (nombres aléatoires communs)
+    //  spotShifts : nSpot chocs relatifs de spot, volShifts : nVol chocs absolus de volatilité.
+    //  price, priceSE : nSpot * nVol doubles, ligne par choc de spot (price[i * nVol + j]).
+    //  Retour : prix du premier point de l'échelle.
+    // ============================================================================
+
+    OPT_API double opt_lb_call_ladder_mc(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, int antithetic,
+        int nSpot, const double* spotShifts, int nVol, const double* volShifts, double* price, double* priceSE);
+
+    OPT_API double opt_lb_put_ladder_mc(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, int antithetic,
+        int nSpot, const double* spotShifts, int nVol, const double* volShifts, double* price, double* priceSE);
+
+    // ============================================================================
+    //  PORTEFEUILLE DE LOOKBACKS
+    //  Entrées : count contrats en tableaux (type : 0 = call, 1 = put), threads : 0 = séquentiel.
+    //  Sorties : tableaux de count doubles fournis par l'appelant, pointeur nul = non demandé
+    //  (sans grecque demandée, seul le prix est simulé). Contrat invalide : NaN.
+    //  Retour : nombre de contrats valorisés ; NaN (cf. opt_last_error_code) si un type
+    //  n'est ni 0 ni 1 ou si un tableau d'entrée est nul.
+    // ============================================================================
+
+    OPT_API double opt_lb_portfolio_mc(int count, const double* S0, const double* R,
+        const double* sigma, const double* T0, const double* T, const int* type,
+        int paths, int steps, std::uint64_t seed, int antithetic, int threads,
+        double* price, double* priceSE, double* delta, double* deltaSE, double* gamma, double* gammaSE,
+        double* theta, double* thetaSE, double* rho, double* rhoSE, double* vega, double* vegaSE);
+
+    // ============================================================================
+    //  CALCUL ASYNCHRONE (file de jobs, pool de threads : Excel n'est pas bloqué)
+    //  opt_async_lb_submit : type 0 = call, 1 = put ; measure 0 = prix (4 doubles),
+    //  1 = prix + grecques (24 doubles, comme opt_lb_call_risk_mc). Retour : identifiant du job.
+    //  opt_async_status : -1 inconnu, 0 en file, 1 en cours, 2 terminé, 3 en erreur.
+    //  opt_async_collect : copie le résultat dans out et libère le job, retourne le premier
+    //  résultat ; NaN sans message si le job n'est pas terminé. size inférieur à la taille du
+    //  résultat : NaN (OPT_ERR_INVALID_ARGUMENT, message avec la taille requise), job conservé.
+    //  opt_async_cancel : 1 si le job, encore en file, est retiré, 0 sinon.
+    //  Les jobs terminés jamais collectés (cellule recalculée ou supprimée) sont conservés dans
+    //  la limite de opt_async_set_max_finished (1024 par défaut) : au-delà, les plus anciens
+    //  terminés sont évincés (statut -1). Retour : la nouvelle limite.
+    // ============================================================================
+
+    OPT_API double opt_async_lb_submit(int type, int measure, double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, int antithetic);
+
+    OPT_API double opt_async_status(double id);
+
+    OPT_API double opt_async_collect(double id, double* out, int size);
+
+    OPT_API double opt_async_cancel(double id);
+
+    OPT_API double opt_async_set_max_finished(int maxFinished);
+
+    // ============================================================================
+    //  CACHE DES RÉSULTATS MC
+    //  Les exports prix/grecques MC (hors modes avancés) mémorisent leur MCStats par arguments
+    //  identiques (cache LRU partagé, 4096 entrées par défaut, 0 : désactivé).
+    //  ResetResultCache (comme ResetErrorFlag) vide le cache et remet les compteurs à zéro.
+    // ============================================================================
+
+    OPT_API double opt_cache_hits();
+
+    OPT_API double opt_cache_misses();
+
+    OPT_API double opt_cache_size();
+
+    OPT_API double opt_cache_set_capacity(int capacity);
+
+    // ============================================================================
+    //  ERREURS (thread-safe : état propre à chaque thread)
+    //  opt_last_error_code : code (OptErrorCode) du dernier export appelé par ce thread.
+    //  opt_last_error_message / opt_last_error_source : message de l'exception et nom de
+    //  l'export (UTF-8), copiés dans buffer (size octets, zéro final, tronqués) ; retour :
+    //  longueur complète, buffer nul pour l'obtenir seule. Chaînes vides si OPT_OK.
+    //  opt_set_error_dialog : 1 active la boîte de dialogue modale (ancien comportement,
+    //  affichée une seule fois jusqu'à ResetErrorFlag), 0 la désactive (défaut).
+    // ============================================================================
+
+    OPT_API int opt_last_error_code();
+
+    OPT_API int opt_last_error_message(char* buffer, int size);
+
+    OPT_API int opt_last_error_source(char* buffer, int size);
+
+    OPT_API void opt_clear_last_error();
+
+    OPT_API void opt_set_error_dialog(int enabled);
+
+#ifdef _WIN32
+
+    // ============================================================================
+    //  RÉSULTAT COMPLET — TABLEAUX VBA (_xl, Windows uniquement)
+    //  Mêmes calculs que les variantes _full correspondantes, sortie en SAFEARRAY** (1 x 4).
+    // ============================================================================
+
+    OPT_API double opt_lb_call_price_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_price_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_delta_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_delta_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_gamma_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_gamma_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_theta_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_theta_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_rho_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_rho_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_vega_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_vega_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_price_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_price_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_delta_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_delta_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_gamma_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_gamma_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_theta_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_theta_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_rho_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_rho_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_vega_mc_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_vega_mc_vr_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_price_mc_bb_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_call_price_mc_vr_bb_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_price_mc_bb_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+    OPT_API double opt_lb_put_price_mc_vr_bb_full_xl(double S0, double R, double sigma,
+        double T0, double T, int paths, int steps, std::uint64_t seed, SAFEARRAY** out);
+
+#endif // _WIN32
+
 } // extern "C"
 
 #endif // EXPORTS_H
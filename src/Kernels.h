@@ -0,0 +1,196 @@
+#ifndef KERNELS_H
+#define KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define OPT_FORCE_INLINE __forceinline
+#else
+#define OPT_FORCE_INLINE inline __attribute__((always_inline))
+#endif
+
+// Variantes compilées pour un jeu d'instructions donné (GCC/Clang x86-64).
+// Sous MSVC, une seule variante compilée avec les options /arch du projet.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define OPT_HAS_TARGET_VARIANTS 1
+#define OPT_TARGET_AVX2 __attribute__((target("avx2")))
+#define OPT_TARGET_AVX512 __attribute__((target("avx512f")))
+#else
+#define OPT_HAS_TARGET_VARIANTS 0
+#endif
+
+namespace opt {
+
+    /// Nombre de trajectoires avancées de front par le noyau vectorisé (1 registre AVX-512, 2 AVX2).
+    constexpr int kSimdLanes = 8;
+
+    /**
+     * @brief Exponentielle sans branche ni appel de bibliothèque, vectorisable par le compilateur.
+     *
+     * Réduction de Cody–Waite x = k ln2 + r (|r| <= ln2/2), polynôme de Taylor de degré 13
+     * pour e^r, puis multiplication par 2^k construite directement dans l'exposant.
+     * Erreur relative de l'ordre de 1e-16 ; x est borné à [-708, 709].
+     */
+    OPT_FORCE_INLINE double fastExp(double x)
+    {
+        x = (x < -708.0) ? -708.0 : ((x > 709.0) ? 709.0 : x);
+
+        const double kShift = 6755399441055744.0;  // 1.5 * 2^52 : arrondi à l'entier dans la mantisse
+        double kd = x * 1.4426950408889634 + kShift;
+        std::uint64_t kb;
+        std::memcpy(&kb, &kd, sizeof(kb));
+        kd -= kShift;
+
+        double r = x - kd * 6.93147180369123816490e-01;
+        r -= kd * 1.90821492927058770002e-10;
+
+        double p = 1.0 / 6227020800.0;
+        p = p * r + 1.0 / 479001600.0;
+        p = p * r + 1.0 / 39916800.0;
+        p = p * r + 1.0 / 3628800.0;
+        p = p * r + 1.0 / 362880.0;
+        p = p * r + 1.0 / 40320.0;
+        p = p * r + 1.0 / 5040.0;
+        p = p * r + 1.0 / 720.0;
+        p = p * r + 1.0 / 120.0;
+        p = p * r + 1.0 / 24.0;
+        p = p * r + 1.0 / 6.0;
+        p = p * r + 0.5;
+        p = p * r + 1.0;
+        p = p * r + 1.0;
+
+        // 2^k : les bits de poids faible de kb contiennent k (complément à deux)
+        std::uint64_t sb = (kb + 1023) << 52;
+        double scale;
+        std::memcpy(&scale, &sb, sizeof(scale));
+        return p * scale;
+    }
+
+    /**
+     * @brief Jeu d'instructions vectorielles disponible à l'exécution.
+     */
+    enum class SimdLevel { Scalar, AVX2, AVX512 };
+
+    /**
+     * @brief Détecte (une fois) le jeu d'instructions utilisable par les noyaux vectorisés.
+     */
+    inline SimdLevel detectSimdLevel()
+    {
+#if OPT_HAS_TARGET_VARIANTS
+        static const SimdLevel level = []() {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) return SimdLevel::AVX512;
+            if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+            return SimdLevel::Scalar;
+            }();
+        return level;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    /**
+     * @brief Corps du noyau : kSimdLanes trajectoires (SoA) avancées de front.
+     *
+     * @param Zt   Gaussiennes, Zt[j * kSimdLanes + l] = Z_j de la trajectoire l.
+     * @param drift (R - sigma^2/2) dt ; @param vol sigma sqrt(dt) ; @param disc exp(-R tau).
+     * @param logSpace Évolution en log-prix, extrême suivi en log (agrégateurs is_monotone_extreme
+     *                 uniquement) : deux exponentielles par trajectoire.
+     * @param out  kSimdLanes payoffs actualisés.
+     */
+    template <typename TPayoff, typename TAggregator>
+    OPT_FORCE_INLINE void lookbackBatchBody(const TPayoff& payoff, const TAggregator& aggregator,
+        const double* Zt, int steps, double S0, double drift, double vol, double disc, bool flip, bool logSpace,
+        double* out)
+    {
+        alignas(64) double S[kSimdLanes];
+        alignas(64) double A[kSimdLanes];
+        const double sgn = flip ? -1.0 : 1.0;
+
+        if (logSpace) {
+            for (int l = 0; l < kSimdLanes; ++l) {
+                S[l] = 0.0;
+                A[l] = 0.0;
+            }
+
+            for (int j = 0; j < steps; ++j) {
+                const double* Z = Zt + static_cast<std::size_t>(j) * kSimdLanes;
+                const double step = static_cast<double>(j + 1);
+                for (int l = 0; l < kSimdLanes; ++l) {
+                    S[l] += drift + vol * (sgn * Z[l]);
+                    A[l] = aggregator.apply(A[l], S[l], step);
+                }
+            }
+
+            for (int l = 0; l < kSimdLanes; ++l)
+                out[l] = disc * payoff.eval(S0 * fastExp(S[l]), S0 * fastExp(A[l]));
+            return;
+        }
+
+        for (int l = 0; l < kSimdLanes; ++l) {
+            S[l] = S0;
+            A[l] = S0;
+        }
+
+        for (int j = 0; j < steps; ++j) {
+            const double* Z = Zt + static_cast<std::size_t>(j) * kSimdLanes;
+            const double step = static_cast<double>(j + 1);
+            for (int l = 0; l < kSimdLanes; ++l) {
+                S[l] *= fastExp(drift + vol * (sgn * Z[l]));
+                A[l] = aggregator.apply(A[l], S[l], step);
+            }
+        }
+
+        for (int l = 0; l < kSimdLanes; ++l)
+            out[l] = disc * payoff.eval(S[l], A[l]);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    using LookbackBatchKernel = void (*)(const TPayoff&, const TAggregator&, const double*, int,
+        double, double, double, double, bool, bool, double*);
+
+    template <typename TPayoff, typename TAggregator>
+    void lookbackBatchScalar(const TPayoff& payoff, const TAggregator& aggregator, const double* Zt, int steps,
+        double S0, double drift, double vol, double disc, bool flip, bool logSpace, double* out)
+    {
+        lookbackBatchBody(payoff, aggregator, Zt, steps, S0, drift, vol, disc, flip, logSpace, out);
+    }
+
+#if OPT_HAS_TARGET_VARIANTS
+    template <typename TPayoff, typename TAggregator>
+    OPT_TARGET_AVX2 void lookbackBatchAVX2(const TPayoff& payoff, const TAggregator& aggregator, const double* Zt,
+        int steps, double S0, double drift, double vol, double disc, bool flip, bool logSpace, double* out)
+    {
+        lookbackBatchBody(payoff, aggregator, Zt, steps, S0, drift, vol, disc, flip, logSpace, out);
+    }
+
+    template <typename TPayoff, typename TAggregator>
+    OPT_TARGET_AVX512 void lookbackBatchAVX512(const TPayoff& payoff, const TAggregator& aggregator, const double* Zt,
+        int steps, double S0, double drift, double vol, double disc, bool flip, bool logSpace, double* out)
+    {
+        lookbackBatchBody(payoff, aggregator, Zt, steps, S0, drift, vol, disc, flip, logSpace, out);
+    }
+#endif
+
+    /**
+     * @brief Variante du noyau adaptée au processeur courant (repli scalaire).
+     */
+    template <typename TPayoff, typename TAggregator>
+    LookbackBatchKernel<TPayoff, TAggregator> selectLookbackBatchKernel()
+    {
+#if OPT_HAS_TARGET_VARIANTS
+        switch (detectSimdLevel()) {
+        case SimdLevel::AVX512: return &lookbackBatchAVX512<TPayoff, TAggregator>;
+        case SimdLevel::AVX2: return &lookbackBatchAVX2<TPayoff, TAggregator>;
+        default: break;
+        }
+#endif
+        return &lookbackBatchScalar<TPayoff, TAggregator>;
+    }
+
+} // namespace opt
+
+#endif // KERNELS_H
@@ -1,5 +1,6 @@
 #include "pch.h"
 #include "Option.h"
+#include <algorithm>
 
 namespace opt {
 
@@ -17,6 +18,24 @@ namespace opt {
             throw std::invalid_argument("Paramètres non finis (NaN/Inf) interdits.");
     }
 
+    void MCAccumulator::merge(const MCAccumulator& other) {
+        if (other.count == 0) return;
+        if (count == 0) { *this = other; return; }
+
+        std::int64_t n = count + other.count;
+        double delta = other.mean - mean;
+        double na = static_cast<double>(count);
+        double nb = static_cast<double>(other.count);
+        mean += delta * nb / static_cast<double>(n);
+        M2 += other.M2 + delta * delta * na * nb / static_cast<double>(n);
+        count = n;
+    }
+
+    double MCAccumulator::stdError() const {
+        double var = (count > 1) ? (M2 / (count - 1)) : 0.0;
+        return (count > 0) ? std::sqrt(var / count) : std::numeric_limits<double>::quiet_NaN();
+    }
+
     MCStats Option::makeCI95(double mean, double stdError) {
         double z = 1.96; // IC 95%
         MCStats out;
@@ -27,4 +46,20 @@ namespace opt {
         return out;
     }
 
+    MCStats Option::makeControlVariateStats(const MCAccumulator& y, const MCAccumulator& c,
+        const MCAccumulator& sum, double controlMean)
+    {
+        const std::int64_t n = y.count;
+        if (n < 2) return makeCI95(y.mean, y.stdError());
+
+        const double varY = y.M2 / (n - 1);
+        const double varC = c.M2 / (n - 1);
+        const double cov = 0.5 * (sum.M2 / (n - 1) - varY - varC);
+        const double beta = (varC > 0.0) ? cov / varC : 0.0;
+
+        const double estimate = y.mean - beta * (c.mean - controlMean);
+        const double var = std::max<double>(0.0, varY - 2.0 * beta * cov + beta * beta * varC);
+        return makeCI95(estimate, std::sqrt(var / n));
+    }
+
 } // namespace opt
@@ -5,6 +5,7 @@
 #include <cmath>
 #include <limits>
 #include <stdexcept>
+#include <vector>
 
 namespace opt {
 
@@ -18,6 +19,71 @@ namespace opt {
         double ciHigh = std::numeric_limits<double>::quiet_NaN();    ///< Borne supérieure IC 95%.
     };
 
+    /**
+     * @brief Prix et grecques Monte Carlo estimés sur un même jeu de trajectoires.
+     */
+    struct MCRisk {
+        MCStats price;  ///< Prix.
+        MCStats delta;  ///< dP/dS0.
+        MCStats gamma;  ///< d2P/dS0^2.
+        MCStats theta;  ///< dP/dT0.
+        MCStats rho;    ///< dP/dR.
+        MCStats vega;   ///< dP/dsigma.
+    };
+
+    /**
+     * @brief Résultat d'une estimation Monte Carlo à précision cible.
+     */
+    struct MCAdaptiveStats {
+        MCStats stats;             ///< Estimation finale.
+        std::int64_t paths = 0;    ///< Trajectoires simulées (paires antithétiques comptées deux fois).
+        bool converged = false;    ///< true si l'erreur standard cible a été atteinte.
+    };
+
+    /**
+     * @brief Résultat d'un prix Monte Carlo multi-niveaux (MLMC).
+     */
+    struct MCMultilevelStats {
+        MCStats stats;                    ///< Estimation finale (somme télescopique).
+        int coarsestSteps = 0;            ///< Pas de temps du niveau le plus grossier.
+        std::vector<std::int64_t> paths;  ///< Trajectoires par niveau, du plus grossier au plus fin.
+        double cost = 0.0;                ///< Coût total en trajectoires équivalentes au niveau fin.
+    };
+
+    /**
+     * @brief Accumulateur de Welford (moyenne et somme des carrés des écarts en une passe).
+     *
+     * Deux accumulateurs calculés sur des sous-échantillons disjoints peuvent être
+     * fusionnés exactement (formule de Chan et al.), ce qui permet de répartir
+     * les trajectoires sur plusieurs threads.
+     */
+    struct MCAccumulator {
+        std::int64_t count = 0;  ///< Nombre d'échantillons.
+        double mean = 0.0;       ///< Moyenne courante.
+        double M2 = 0.0;         ///< Somme des carrés des écarts à la moyenne.
+
+        /**
+         * @brief Ajoute un échantillon.
+         */
+        void push(double x) {
+            ++count;
+            double d = x - mean;
+            mean += d / count;
+            double d2 = x - mean;
+            M2 += d * d2;
+        }
+
+        /**
+         * @brief Fusionne un accumulateur calculé sur un autre sous-échantillon (Chan).
+         */
+        void merge(const MCAccumulator& other);
+
+        /**
+         * @brief Erreur standard de la moyenne (NaN si aucun échantillon).
+         */
+        double stdError() const;
+    };
+
     /**
      * @brief Interface abstraite commune pour les options en Black–Scholes (Monte Carlo).
      *
@@ -40,6 +106,20 @@ namespace opt {
          */
         static MCStats makeCI95(double mean, double stdError);
 
+        /**
+         * @brief Estimateur à variable de contrôle avec coefficient optimal estimé sur l'échantillon.
+         *
+         * beta = Cov(Y, C) / Var(C), estimateur moyenne(Y) - beta (moyenne(C) - E[C]),
+         * variance résiduelle Var(Y) - Cov(Y, C)^2 / Var(C) (biais en O(1/n), négligeable).
+         *
+         * @param y          Accumulateur de l'estimateur Y.
+         * @param c          Accumulateur du contrôle C (mêmes échantillons).
+         * @param sum        Accumulateur de Y + C (donne la covariance).
+         * @param controlMean Espérance exacte de C.
+         */
+        static MCStats makeControlVariateStats(const MCAccumulator& y, const MCAccumulator& c,
+            const MCAccumulator& sum, double controlMean);
+
     public:
         /**
          * @brief Construit une option en modèle de Black–Scholes.
@@ -0,0 +1,68 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opt {
+
+    /**
+     * @brief Nombre de threads effectivement utilisés par parallelFor(nTasks, threads, ...).
+     */
+    inline int parallelWorkers(int nTasks, int threads) {
+        return std::max<int>(1, std::min<int>(threads, nTasks));
+    }
+
+    /**
+     * @brief Exécute task(i, worker) pour i = 0..nTasks-1 sur au plus @p threads threads.
+     *
+     * Les tâches sont distribuées dynamiquement (compteur atomique) ; le thread appelant
+     * participe au calcul. La première exception levée par une tâche est relancée
+     * dans le thread appelant une fois tous les threads terminés.
+     *
+     * @param nTasks  Nombre de tâches.
+     * @param threads Nombre maximal de threads (>= 1).
+     * @param task    Callable : void(int i, int worker), worker dans [0, parallelWorkers(nTasks, threads))
+     *                identifie le thread (permet de réutiliser une mémoire de travail par thread).
+     */
+    template <typename Task>
+    void parallelFor(int nTasks, int threads, Task&& task)
+    {
+        if (nTasks <= 0) return;
+        int nThreads = parallelWorkers(nTasks, threads);
+
+        std::atomic<int> next(0);
+        std::exception_ptr error;
+        std::mutex errorMutex;
+
+        auto worker = [&](int w) {
+            for (;;) {
+                int i = next.fetch_add(1);
+                if (i >= nTasks) return;
+                try {
+                    task(i, w);
+                }
+                catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    if (!error) error = std::current_exception();
+                    next.store(nTasks);
+                }
+            }
+            };
+
+        std::vector<std::thread> pool;
+        pool.reserve(nThreads - 1);
+        for (int t = 1; t < nThreads; ++t) pool.emplace_back(worker, t);
+        worker(0);
+        for (auto& th : pool) th.join();
+
+        if (error) std::rethrow_exception(error);
+    }
+
+} // namespace opt
+
+#endif // PARALLEL_H
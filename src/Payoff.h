@@ -1,12 +1,18 @@
 ﻿#ifndef PAYOFF_H
 #define PAYOFF_H
 
+#include <limits>
 #include <stdexcept>
 
 namespace opt {
 
     /**
      * @brief Classe abstraite représentant le payoff d'une option.
+     *
+     * Les payoffs concrets exposent en plus :
+     *  - eval<T>(S, K) : même calcul sur un type numérique générique (cf. AD.h) ;
+     *  - isLipschitz : payoff continu et lipschitzien (condition de validité de l'estimateur pathwise) ;
+     *  - homogeneityDegree : degré k tel que payoff(a.S, a.K) = a^k payoff(S, K).
      */
     class Payoff {
     public:
@@ -22,35 +28,205 @@ namespace opt {
     /**
      * @brief Payoff d'une option d'achat (call).
      */
-    class PayoffCall : public Payoff {
+    class PayoffCall final : public Payoff {
     public:
+        static constexpr bool isLipschitz = true;
+        static constexpr int homogeneityDegree = 1;
+
         double operator()(double S, double K) const override;
+
+        template <typename T>
+        T eval(const T& S, const T& K) const {
+            if (K < 0.0)
+                throw std::invalid_argument("Strike doit être non-négatif");
+            return (S > K) ? S - K : T(0.0);
+        }
     };
 
     /**
      * @brief Payoff d'une option de vente (put).
      */
-    class PayoffPut : public Payoff {
+    class PayoffPut final : public Payoff {
     public:
+        static constexpr bool isLipschitz = true;
+        static constexpr int homogeneityDegree = 1;
+
         double operator()(double S, double K) const override;
+
+        template <typename T>
+        T eval(const T& S, const T& K) const {
+            if (K < 0.0)
+                throw std::invalid_argument("Strike doit être non-négatif");
+            return (K > S) ? K - S : T(0.0);
+        }
     };
 
     /**
      * @brief Payoff d'un call digital.
      */
-    class PayoffDigitCall : public Payoff {
+    class PayoffDigitCall final : public Payoff {
     public:
+        static constexpr bool isLipschitz = false;
+        static constexpr int homogeneityDegree = 0;
+
         double operator()(double S, double K) const override;
+
+        template <typename T>
+        T eval(const T& S, const T& K) const {
+            if (K < 0.0)
+                throw std::invalid_argument("Strike doit être non-négatif");
+            return (S > K) ? T(1.0) : T(0.0);
+        }
     };
 
     /**
      * @brief Payoff d'un put digital.
      */
-    class PayoffDigitPut : public Payoff {
+    class PayoffDigitPut final : public Payoff {
     public:
+        static constexpr bool isLipschitz = false;
+        static constexpr int homogeneityDegree = 0;
+
         double operator()(double S, double K) const override;
+
+        template <typename T>
+        T eval(const T& S, const T& K) const {
+            if (K < 0.0)
+                throw std::invalid_argument("Strike doit être non-négatif");
+            return (K > S) ? T(1.0) : T(0.0);
+        }
+    };
+
+    /**
+     * @brief Politique de payoff d'achat : max(x - k, 0).
+     *
+     * Les politiques sont sans état ni validation : value(x, k) est constexpr et, sur des
+     * doubles, le ternaire se compile en maxsd / masque vectoriel (aucun branchement dans la
+     * boucle des trajectoires). Les strikes sont validés une fois, à la construction du payoff.
+     */
+    struct CallPolicy {
+        static constexpr bool isLipschitz = true;
+        static constexpr int homogeneityDegree = 1;
+
+        template <typename T>
+        static constexpr T value(const T& x, const T& k) {
+            const T d = x - k;
+            return (d > 0.0) ? d : T(0.0);
+        }
+    };
+
+    /**
+     * @brief Politique de payoff de vente : max(k - x, 0).
+     */
+    struct PutPolicy {
+        static constexpr bool isLipschitz = true;
+        static constexpr int homogeneityDegree = 1;
+
+        template <typename T>
+        static constexpr T value(const T& x, const T& k) {
+            const T d = k - x;
+            return (d > 0.0) ? d : T(0.0);
+        }
+    };
+
+    /**
+     * @brief Politique de call digital : 1 si x > k.
+     */
+    struct DigitCallPolicy {
+        static constexpr bool isLipschitz = false;
+        static constexpr int homogeneityDegree = 0;
+
+        template <typename T>
+        static constexpr T value(const T& x, const T& k) {
+            return (x > k) ? T(1.0) : T(0.0);
+        }
+    };
+
+    /**
+     * @brief Politique de put digital : 1 si x < k.
+     */
+    struct DigitPutPolicy {
+        static constexpr bool isLipschitz = false;
+        static constexpr int homogeneityDegree = 0;
+
+        template <typename T>
+        static constexpr T value(const T& x, const T& k) {
+            return (k > x) ? T(1.0) : T(0.0);
+        }
     };
 
+    /**
+     * @brief Payoff à strike flottant : Policy::value(S, agrégat), sans classe de base virtuelle.
+     *
+     * Le strike est l'agrégat de la trajectoire (strictement positif : agrégats initialisés à
+     * S0 > 0), aucune vérification n'est donc faite à l'évaluation. Défini dans l'en-tête :
+     * l'appel est inliné dans les noyaux d'Asian. Ex. FloatingStrikePayoff<CallPolicy> + LookMin
+     * : lookback à strike flottant S_T - min.
+     */
+    template <typename Policy>
+    class FloatingStrikePayoff final {
+    public:
+        static constexpr bool isLipschitz = Policy::isLipschitz;
+        static constexpr int homogeneityDegree = Policy::homogeneityDegree;
+
+        constexpr FloatingStrikePayoff() = default;
+
+        constexpr double operator()(double S, double K) const noexcept {
+            return Policy::value(S, K);
+        }
+
+        template <typename T>
+        constexpr T eval(const T& S, const T& K) const {
+            return Policy::value(S, K);
+        }
+    };
+
+    /**
+     * @brief Payoff à strike fixe : Policy::value(agrégat, K), K porté par le payoff.
+     *
+     * Ex. FixedStrikePayoff<CallPolicy> + LookMax : max(max S - K, 0) ;
+     * FixedStrikePayoff<PutPolicy> + LookMin : max(K - min S, 0). Le strike est validé une seule
+     * fois, à la construction. Le payoff n'est pas homogène en S0 (homogeneityDegree = -1) :
+     * gamma et scenarioMC valorisent alors directement chaque spot.
+     */
+    template <typename Policy>
+    class FixedStrikePayoff final {
+    public:
+        static constexpr bool isLipschitz = Policy::isLipschitz;
+        static constexpr int homogeneityDegree = -1;
+
+        /**
+         * @param K Strike (>= 0, fini).
+         * @throw std::invalid_argument si K < 0 ou non fini.
+         */
+        constexpr explicit FixedStrikePayoff(double K)
+            : K_((K >= 0.0 && K <= (std::numeric_limits<double>::max)())
+                ? K : throw std::invalid_argument("Strike doit être non-négatif")) {}
+
+        constexpr double strike() const noexcept { return K_; }
+
+        /// @param S Non utilisé (le sous-jacent payé est l'agrégat).
+        constexpr double operator()(double, double agg) const noexcept {
+            return Policy::value(agg, K_);
+        }
+
+        template <typename T>
+        constexpr T eval(const T&, const T& agg) const {
+            return Policy::value(agg, T(K_));
+        }
+
+    private:
+        double K_;   ///< Strike fixe.
+    };
+
+    /// Lookbacks à strike flottant (avec LookMin : S_T - min ; avec LookMax : max - S_T).
+    using FloatingCallPayoff = FloatingStrikePayoff<CallPolicy>;
+    using FloatingPutPayoff = FloatingStrikePayoff<PutPolicy>;
+
+    /// Lookbacks à strike fixe (avec LookMax : max - K ; avec LookMin : K - min).
+    using FixedCallPayoff = FixedStrikePayoff<CallPolicy>;
+    using FixedPutPayoff = FixedStrikePayoff<PutPolicy>;
+
 } // namespace opt
 
 #endif // PAYOFF_H
@@ -0,0 +1,171 @@
+#include "pch.h"
+#include "Portfolio.h"
+#include "Aggregator.h"
+#include "Parallel.h"
+#include "Payoff.h"
+#include <limits>
+#include <stdexcept>
+
+namespace opt {
+
+    namespace {
+
+        using LookbackCall = Asian<FloatingCallPayoff, LookMin>;
+        using LookbackPut = Asian<FloatingPutPayoff, LookMax>;
+
+        /// Contrats valorisés ensemble sur les mêmes tirages (au plus).
+        constexpr int kMaxChunkContracts = 64;
+
+        /// Contrat valide : indice dans le portefeuille et dans calls / puts.
+        struct Entry {
+            int index;
+            LookbackType type;
+            int slot;
+        };
+
+        void write(double* array, int i, double value) {
+            if (array != nullptr) array[i] = value;
+        }
+
+        void writeStats(double* value, double* se, int i, const MCAccumulator& acc) {
+            write(value, i, acc.mean);
+            write(se, i, acc.stdError());
+        }
+
+        template <typename Option, typename Fn>
+        std::vector<MCAccumulator> simulateWith(const Option& driver, int paths, int steps, std::uint64_t seed,
+            bool antithetic, int outputs, Fn&& sample)
+        {
+            return driver.simulateMulti(paths, steps, seed, antithetic, outputs, sample);
+        }
+
+    } // namespace
+
+    int priceLookbackPortfolio(const LookbackPortfolio& portfolio, int paths, int steps, std::uint64_t seed,
+        bool antithetic, const MCConfig& config, const RiskBumps& bumps, const LookbackPortfolioResults& results)
+    {
+        const int n = portfolio.count;
+        if (n < 0) throw std::invalid_argument("count doit être >= 0.");
+        if (n > 0 && (portfolio.S0 == nullptr || portfolio.R == nullptr || portfolio.sigma == nullptr
+            || portfolio.T0 == nullptr || portfolio.T == nullptr || portfolio.type == nullptr))
+            throw std::invalid_argument("Tableaux d'entrée du portefeuille nuls.");
+        if (paths <= 0) throw std::invalid_argument("paths doit être > 0.");
+        if (steps <= 0) throw std::invalid_argument("steps doit être > 0.");
+        if (config.threads < 0) throw std::invalid_argument("threads doit être >= 0.");
+
+        // Les contrats sont évalués par priceSample / riskSample : ni noyau vectorisé, ni variable
+        // de contrôle, ni antithétiques fusionnés (le résultat ne serait plus celui de riskMC).
+        if (config.kernel == PathKernel::Batched)
+            throw std::invalid_argument("Portefeuille : noyau vectorisé (PathKernel::Batched) non supporté.");
+        if (config.control != ControlVariate::None)
+            throw std::invalid_argument("Portefeuille : variable de contrôle non supportée.");
+        if (config.fusedAntithetic)
+            throw std::invalid_argument("Portefeuille : antithétiques fusionnés non supportés.");
+
+        for (int i = 0; i < n; ++i) {
+            if (portfolio.type[i] != static_cast<int>(LookbackType::Call)
+                && portfolio.type[i] != static_cast<int>(LookbackType::Put))
+                throw std::invalid_argument("type doit valoir 0 (call) ou 1 (put).");
+        }
+
+        const bool greeks = results.delta || results.deltaSE || results.gamma || results.gammaSE
+            || results.theta || results.thetaSE || results.rho || results.rhoSE || results.vega || results.vegaSE;
+        const int outputs = greeks ? 6 : 1;
+
+        // Les paquets s'exécutent en parallèle ; chacun garde la décomposition de MCConfig::threads
+        // (flux unique si 0, blocs sinon) sans parallélisme imbriqué : mêmes tirages que riskMC.
+        MCConfig inner = config;
+        inner.threads = std::min<int>(config.threads, 1);
+
+        const double nan = std::numeric_limits<double>::quiet_NaN();
+        std::vector<LookbackCall> calls;
+        std::vector<LookbackPut> puts;
+        std::vector<Entry> entries;
+        entries.reserve(n);
+
+        for (int i = 0; i < n; ++i) {
+            for (double* array : { results.price, results.priceSE, results.delta, results.deltaSE,
+                results.gamma, results.gammaSE, results.theta, results.thetaSE,
+                results.rho, results.rhoSE, results.vega, results.vegaSE })
+                write(array, i, nan);
+
+            try {
+                if (portfolio.type[i] == static_cast<int>(LookbackType::Call)) {
+                    LookbackCall option(portfolio.S0[i], portfolio.R[i], portfolio.sigma[i], portfolio.T0[i],
+                        portfolio.T[i], FloatingCallPayoff(), LookMin());
+                    option.setConfig(inner);
+                    if (greeks) option.validateRisk(bumps);
+                    entries.push_back({ i, LookbackType::Call, static_cast<int>(calls.size()) });
+                    calls.push_back(option);
+                }
+                else {
+                    LookbackPut option(portfolio.S0[i], portfolio.R[i], portfolio.sigma[i], portfolio.T0[i],
+                        portfolio.T[i], FloatingPutPayoff(), LookMax());
+                    option.setConfig(inner);
+                    if (greeks) option.validateRisk(bumps);
+                    entries.push_back({ i, LookbackType::Put, static_cast<int>(puts.size()) });
+                    puts.push_back(option);
+                }
+            }
+            catch (const std::invalid_argument&) {
+                // Contrat invalide : sorties laissées à NaN
+            }
+        }
+
+        const int valid = static_cast<int>(entries.size());
+        if (valid == 0) return 0;
+
+        // Paquets assez petits pour occuper tous les threads, assez grands pour amortir les tirages
+        const int workers = std::max<int>(1, config.threads);
+        const int chunkSize = std::max<int>(1, std::min<int>(kMaxChunkContracts, (valid + 4 * workers - 1) / (4 * workers)));
+        const int chunks = (valid + chunkSize - 1) / chunkSize;
+
+        auto runChunk = [&](int c, int) {
+            const int first = c * chunkSize;
+            const int m = std::min<int>(chunkSize, valid - first);
+
+            auto sample = [&](const std::vector<double>& Zs, bool flip, double* out) {
+                for (int j = 0; j < m; ++j) {
+                    const Entry& e = entries[first + j];
+                    if (greeks) {
+                        if (e.type == LookbackType::Call) calls[e.slot].riskSample(Zs, flip, steps, bumps, out + 6 * j);
+                        else puts[e.slot].riskSample(Zs, flip, steps, bumps, out + 6 * j);
+                    }
+                    else {
+                        out[j] = (e.type == LookbackType::Call)
+                            ? calls[e.slot].priceSample(Zs, flip, steps)
+                            : puts[e.slot].priceSample(Zs, flip, steps);
+                    }
+                }
+                };
+
+            // L'ordonnanceur ne dépend que de MCConfig : n'importe quel contrat du paquet convient
+            const Entry& lead = entries[first];
+            std::vector<MCAccumulator> acc = (lead.type == LookbackType::Call)
+                ? simulateWith(calls[lead.slot], paths, steps, seed, antithetic, outputs * m, sample)
+                : simulateWith(puts[lead.slot], paths, steps, seed, antithetic, outputs * m, sample);
+
+            for (int j = 0; j < m; ++j) {
+                const int i = entries[first + j].index;
+                const MCAccumulator* a = &acc[static_cast<std::size_t>(outputs) * j];
+                writeStats(results.price, results.priceSE, i, a[0]);
+                if (!greeks) continue;
+                writeStats(results.delta, results.deltaSE, i, a[1]);
+                writeStats(results.gamma, results.gammaSE, i, a[2]);
+                writeStats(results.theta, results.thetaSE, i, a[3]);
+                writeStats(results.rho, results.rhoSE, i, a[4]);
+                writeStats(results.vega, results.vegaSE, i, a[5]);
+            }
+            };
+
+        if (config.threads == 0) {
+            for (int c = 0; c < chunks; ++c) runChunk(c, 0);
+        }
+        else {
+            parallelFor(chunks, config.threads, runChunk);
+        }
+
+        return valid;
+    }
+
+} // namespace opt
@@ -0,0 +1,72 @@
+#ifndef PORTFOLIO_H
+#define PORTFOLIO_H
+
+#include "Asian.h"
+
+namespace opt {
+
+    /**
+     * @brief Type de lookback à strike flottant d'un portefeuille.
+     */
+    enum class LookbackType : int {
+        Call = 0,  ///< S_T - min (FloatingCallPayoff + LookMin).
+        Put = 1    ///< max - S_T (FloatingPutPayoff + LookMax).
+    };
+
+    /**
+     * @brief Portefeuille de lookbacks en structure de tableaux (SoA) : contrat i = (S0[i], ..., type[i]).
+     *
+     * Les tableaux appartiennent à l'appelant et contiennent count éléments.
+     */
+    struct LookbackPortfolio {
+        int count = 0;
+        const double* S0 = nullptr;
+        const double* R = nullptr;
+        const double* sigma = nullptr;
+        const double* T0 = nullptr;
+        const double* T = nullptr;
+        const int* type = nullptr;   ///< Valeurs de LookbackType.
+    };
+
+    /**
+     * @brief Tableaux de sortie (count éléments chacun, fournis par l'appelant).
+     *
+     * Un pointeur nul signifie que la grandeur n'est pas demandée ; si aucune grecque n'est
+     * demandée, seul le prix est simulé. Un contrat invalide reçoit NaN partout.
+     */
+    struct LookbackPortfolioResults {
+        double* price = nullptr;
+        double* priceSE = nullptr;
+        double* delta = nullptr;
+        double* deltaSE = nullptr;
+        double* gamma = nullptr;
+        double* gammaSE = nullptr;
+        double* theta = nullptr;
+        double* thetaSE = nullptr;
+        double* rho = nullptr;
+        double* rhoSE = nullptr;
+        double* vega = nullptr;
+        double* vegaSE = nullptr;
+    };
+
+    /**
+     * @brief Valorise un portefeuille de lookbacks sur des tirages partagés.
+     *
+     * Les contrats sont répartis en paquets traités en parallèle (MCConfig::threads, 0 : séquentiel).
+     * Dans un paquet, chaque vecteur gaussien est tiré une seule fois puis évalué pour tous les
+     * contrats : les gaussiennes étant réduites, elles ne dépendent que de steps et servent à tout
+     * contrat quelle que soit sa maturité. Chaque contrat reçoit exactement le résultat de
+     * riskMC (ou priceMC) appelé avec les mêmes paramètres et la même configuration, celle-ci
+     * étant limitée au moteur scalaire : PathKernel::Batched, les variables de contrôle et
+     * MCConfig::fusedAntithetic sont refusés.
+     *
+     * @return Nombre de contrats valorisés (les contrats aux paramètres invalides sont ignorés).
+     * @throw std::invalid_argument si les tableaux d'entrée sont nuls, paths/steps invalides, un
+     *        type n'est pas un LookbackType ou la configuration n'est pas supportée.
+     */
+    int priceLookbackPortfolio(const LookbackPortfolio& portfolio, int paths, int steps, std::uint64_t seed,
+        bool antithetic, const MCConfig& config, const RiskBumps& bumps, const LookbackPortfolioResults& results);
+
+} // namespace opt
+
+#endif // PORTFOLIO_H
@@ -0,0 +1,260 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include "BrownianBridge.h"
+#include "Sobol.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <new>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+namespace opt {
+
+    /**
+     * @brief Mélangeur SplitMix64 (Steele, Lea & Flood) : bijection 64 bits bien répartie.
+     */
+    inline std::uint64_t splitmix64(std::uint64_t x) {
+        x += 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+    /**
+     * @brief Graine du sous-flux numéro @p stream dérivée de la graine utilisateur.
+     *
+     * Chaque bloc de trajectoires du moteur parallèle initialise son propre générateur
+     * avec cette graine : le résultat ne dépend que de (seed, bloc), jamais de l'ordre
+     * d'exécution ni du nombre de threads.
+     */
+    inline std::uint64_t substreamSeed(std::uint64_t seed, std::uint64_t stream) {
+        return splitmix64(seed ^ splitmix64(stream));
+    }
+
+    /**
+     * @brief Générateur à compteur Philox4x32-10 (Salmon et al., Random123).
+     *
+     * Fonction pure (compteur 128 bits, clé 64 bits) -> 128 bits aléatoires : n'importe quel
+     * tirage est accessible en O(1), sans générer ceux qui le précèdent.
+     */
+    struct Philox4x32 {
+        std::uint32_t key[2];  ///< Clé (graine).
+
+        explicit Philox4x32(std::uint64_t seed) {
+            key[0] = static_cast<std::uint32_t>(seed);
+            key[1] = static_cast<std::uint32_t>(seed >> 32);
+        }
+
+        /**
+         * @brief Applique les 10 tours au compteur @p ctr (modifié en place).
+         */
+        void operator()(std::uint32_t ctr[4]) const {
+            const std::uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+            const std::uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+            std::uint32_t k0 = key[0], k1 = key[1];
+
+            for (int r = 0; r < 10; ++r) {
+                if (r > 0) { k0 += W0; k1 += W1; }
+                std::uint64_t p0 = static_cast<std::uint64_t>(M0) * ctr[0];
+                std::uint64_t p1 = static_cast<std::uint64_t>(M1) * ctr[2];
+                std::uint32_t hi0 = static_cast<std::uint32_t>(p0 >> 32), lo0 = static_cast<std::uint32_t>(p0);
+                std::uint32_t hi1 = static_cast<std::uint32_t>(p1 >> 32), lo1 = static_cast<std::uint32_t>(p1);
+                std::uint32_t c1 = ctr[1], c3 = ctr[3];
+                ctr[0] = hi1 ^ c1 ^ k0;
+                ctr[1] = lo1;
+                ctr[2] = hi0 ^ c3 ^ k1;
+                ctr[3] = lo0;
+            }
+        }
+    };
+
+    /**
+     * @brief Uniforme dans l'ouvert (0,1) à partir de 64 bits (53 bits de mantisse).
+     */
+    inline double uniformOpen(std::uint64_t bits) {
+        return (static_cast<double>(bits >> 11) + 0.5) * (1.0 / 9007199254740992.0);
+    }
+
+    /**
+     * @brief Inverse de la fonction de répartition normale centrée réduite (Wichura, AS 241).
+     *
+     * Fractions rationnelles, précision relative d'environ 1e-16 sur (0,1) ;
+     * pas de rejet ni d'état, contrairement à std::normal_distribution.
+     */
+    inline double inverseNormalCdf(double p) {
+        double q = p - 0.5;
+
+        if (std::fabs(q) <= 0.425) {
+            double r = 0.180625 - q * q;
+            return q * (((((((2509.0809287301226727 * r + 33430.575583588128105) * r + 67265.770927008700853) * r
+                + 45921.953931549871457) * r + 13731.693765509461125) * r + 1971.5909503065514427) * r
+                + 133.14166789178437745) * r + 3.387132872796366608)
+                / (((((((5226.495278852545925 * r + 28729.085735721942674) * r + 39307.89580009271061) * r
+                + 21213.794301586595867) * r + 5394.1960214247511077) * r + 687.1870074920579083) * r
+                + 42.313330701600911252) * r + 1.0);
+        }
+
+        double r = (q < 0.0) ? p : 1.0 - p;
+        r = std::sqrt(-std::log(r));
+        double x;
+
+        if (r <= 5.0) {
+            r -= 1.6;
+            x = (((((((7.7454501427834140764e-4 * r + 0.0227238449892691845833) * r + 0.24178072517745061177) * r
+                + 1.27045825245236838258) * r + 3.64784832476320460504) * r + 5.7694972214606914055) * r
+                + 4.6303378461565452959) * r + 1.42343711074968357734)
+                / (((((((1.05075007164441684324e-9 * r + 5.475938084995344946e-4) * r + 0.0151986665636164571966) * r
+                + 0.14810397642748007459) * r + 0.68976733498510000455) * r + 1.6763848301838038494) * r
+                + 2.05319162663775882187) * r + 1.0);
+        }
+        else {
+            r -= 5.0;
+            x = (((((((2.01033439929228813265e-7 * r + 2.71155556874348757815e-5) * r + 0.0012426609473880784386) * r
+                + 0.026532189526576123093) * r + 0.29656057182850489123) * r + 1.7848265399172913358) * r
+                + 5.4637849111641143699) * r + 6.6579046435011037772)
+                / (((((((2.04426310338993978564e-15 * r + 1.4215117583164458887e-7) * r + 1.8463183175100546818e-5) * r
+                + 7.868691311456132591e-4) * r + 0.0148753612908506148525) * r + 0.13692988092273580531) * r
+                + 0.59983220655588793769) * r + 1.0);
+        }
+
+        return (q < 0.0) ? -x : x;
+    }
+
+    /**
+     * @brief Générateur pseudo-aléatoire des moteurs Monte Carlo.
+     */
+    enum class RngKind {
+        /// std::mt19937_64 + std::normal_distribution, flux séquentiel (historique).
+        MersenneTwister,
+        /**
+         * Philox4x32-10 à compteur (seed, trajectoire, pas) + inverse de la loi normale :
+         * la trajectoire i est reproductible isolément, en O(1), quel que soit le
+         * découpage (threads, blocs, machines).
+         */
+        Philox,
+        /**
+         * Quasi-Monte Carlo randomisé : suite de Sobol (Joe & Kuo) à décalage digital
+         * aléatoire, gaussiennes ordonnées par pont brownien. Au-delà de kSobolMaxDims pas,
+         * les coordonnées restantes (les moins importantes du pont) sont complétées par Philox.
+         */
+        Sobol
+    };
+
+    /**
+     * @brief Source des vecteurs gaussiens d'une suite de trajectoires consécutives.
+     *
+     * - MersenneTwister : flux mt19937_64(seed), tirages consommés dans l'ordre ;
+     * - Philox : la gaussienne j de la trajectoire i ne dépend que de (seed, i, j) ;
+     *   la source commence à la trajectoire @p firstPath ;
+     * - Sobol : trajectoire i = point i de la suite de Sobol décalée par XOR d'un vecteur
+     *   tiré de seed (une randomisation), converti en incréments par pont brownien.
+     *   Toutes les trajectoires d'un générateur doivent avoir le même nombre de pas.
+     *
+     * L'état mt19937_64 (2,5 Ko, 312 mots initialisés) n'est construit que pour MersenneTwister :
+     * Philox et Sobol créent un générateur par bloc sans payer cette initialisation.
+     */
+    class NormalGenerator {
+    public:
+        NormalGenerator(RngKind kind, std::uint64_t seed, std::uint64_t firstPath)
+            : seed_(seed), kind_(kind), philox_(seed), path_(firstPath)
+        {
+            if (kind_ == RngKind::MersenneTwister) new (&mtStorage_) MtState(seed);
+        }
+
+        ~NormalGenerator() {
+            if (kind_ == RngKind::MersenneTwister) mt().~MtState();
+        }
+
+        NormalGenerator(const NormalGenerator&) = delete;
+        NormalGenerator& operator=(const NormalGenerator&) = delete;
+
+        /**
+         * @brief Remplit Z[0..n-1] avec les gaussiennes de la trajectoire suivante.
+         *
+         * Z[0..pathDraws-1] sont les incréments de la trajectoire (ordonnés par pont brownien en
+         * Sobol) ; Z[pathDraws..n-1] sont des gaussiennes auxiliaires indépendantes (ex. uniformes
+         * de la correction de pont), tirées en Sobol dans les dimensions suivantes puis par Philox.
+         */
+        void fill(double* Z, int n, int pathDraws) {
+            if (kind_ == RngKind::MersenneTwister) {
+                MtState& state = mt();
+                for (int j = 0; j < n; ++j) Z[j] = state.nd(state.engine);
+            }
+            else if (kind_ == RngKind::Philox) {
+                philoxFill(Z, 0, n);
+            }
+            else {
+                if (sobol_.dims() == 0) initSobol(n, pathDraws);
+
+                const std::uint32_t* x = sobol_.current();
+                const int dims = sobol_.dims();
+                for (int d = 0; d < dims; ++d)
+                    z_[d] = inverseNormalCdf((static_cast<double>(x[d] ^ shift_[d]) + 0.5) * (1.0 / 4294967296.0));
+                if (dims < n) philoxFill(z_.data(), dims, n);
+                sobol_.advance();
+
+                bridge_.transform(z_.data(), Z);
+                std::copy(z_.begin() + pathDraws, z_.begin() + n, Z + pathDraws);
+            }
+            ++path_;
+        }
+
+        /// Trajectoire sans gaussiennes auxiliaires.
+        void fill(double* Z, int n) { fill(Z, n, n); }
+
+    private:
+        /// Flux historique : std::mt19937_64 + std::normal_distribution.
+        struct MtState {
+            explicit MtState(std::uint64_t seed) : engine(seed), nd(0.0, 1.0) {}
+            std::mt19937_64 engine;
+            std::normal_distribution<double> nd;
+        };
+
+        MtState& mt() { return *reinterpret_cast<MtState*>(&mtStorage_); }
+
+        /// Gaussiennes Philox Z[from..n-1] de la trajectoire courante (compteur (j/2, trajectoire)).
+        void philoxFill(double* Z, int from, int n) const {
+            for (int j = from; j < n; j += 2) {
+                std::uint32_t ctr[4] = {
+                    static_cast<std::uint32_t>(j / 2),
+                    static_cast<std::uint32_t>(path_),
+                    static_cast<std::uint32_t>(path_ >> 32),
+                    0u
+                };
+                philox_(ctr);
+                std::uint64_t b0 = (static_cast<std::uint64_t>(ctr[1]) << 32) | ctr[0];
+                std::uint64_t b1 = (static_cast<std::uint64_t>(ctr[3]) << 32) | ctr[2];
+                Z[j] = inverseNormalCdf(uniformOpen(b0));
+                if (j + 1 < n) Z[j + 1] = inverseNormalCdf(uniformOpen(b1));
+            }
+        }
+
+        /// Positionne la suite sur la trajectoire courante et tire le décalage digital.
+        void initSobol(int n, int pathDraws) {
+            const int dims = std::min<int>(n, kSobolMaxDims);
+            sobol_.reset(dims, path_);
+            shift_.resize(dims);
+            for (int d = 0; d < dims; ++d)
+                shift_[d] = static_cast<std::uint32_t>(splitmix64(seed_ + static_cast<std::uint64_t>(d)) >> 32);
+            bridge_ = BrownianBridge(pathDraws);
+            z_.resize(n);
+        }
+
+        std::uint64_t seed_;
+        RngKind kind_;
+        /// MtState, construit seulement si kind_ == MersenneTwister.
+        std::aligned_storage<sizeof(MtState), alignof(MtState)>::type mtStorage_;
+        Philox4x32 philox_;
+        std::uint64_t path_;
+        SobolSequence sobol_;
+        std::vector<std::uint32_t> shift_;
+        BrownianBridge bridge_;
+        std::vector<double> z_;
+    };
+
+} // namespace opt
+
+#endif // RANDOM_H
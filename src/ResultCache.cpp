@@ -0,0 +1,134 @@
+#include "pch.h"
+#include "ResultCache.h"
+#include "Random.h"
+#include <cstring>
+
+namespace opt {
+
+    namespace {
+
+        /// Bits d'un double, zéros signés confondus.
+        std::uint64_t bitsOf(double x) {
+            x += 0.0;
+            std::uint64_t bits;
+            std::memcpy(&bits, &x, sizeof(bits));
+            return bits;
+        }
+
+        std::uint64_t combine(std::uint64_t h, std::uint64_t v) {
+            return splitmix64(h ^ v);
+        }
+
+    } // namespace
+
+    bool PricingKey::operator==(const PricingKey& other) const
+    {
+        return option == other.option && quantity == other.quantity && antithetic == other.antithetic
+            && S0 == other.S0 && R == other.R && sigma == other.sigma && T0 == other.T0 && T == other.T
+            && paths == other.paths && steps == other.steps && seed == other.seed;
+    }
+
+    std::size_t PricingKeyHash::operator()(const PricingKey& key) const
+    {
+        std::uint64_t h = static_cast<std::uint64_t>(key.option);
+        h = combine(h, static_cast<std::uint64_t>(key.quantity) * 2 + (key.antithetic ? 1 : 0));
+        h = combine(h, bitsOf(key.S0));
+        h = combine(h, bitsOf(key.R));
+        h = combine(h, bitsOf(key.sigma));
+        h = combine(h, bitsOf(key.T0));
+        h = combine(h, bitsOf(key.T));
+        h = combine(h, (static_cast<std::uint64_t>(static_cast<std::uint32_t>(key.paths)) << 32)
+            | static_cast<std::uint32_t>(key.steps));
+        h = combine(h, key.seed);
+        return static_cast<std::size_t>(h);
+    }
+
+    ResultCache::ResultCache(std::size_t capacity) : capacity_(capacity) {}
+
+    ResultCache& ResultCache::instance()
+    {
+        static ResultCache cache;
+        return cache;
+    }
+
+    bool ResultCache::find(const PricingKey& key, MCStats& stats)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            ++misses_;
+            return false;
+        }
+
+        entries_.splice(entries_.begin(), entries_, it->second);
+        stats = it->second->second;
+        ++hits_;
+        return true;
+    }
+
+    void ResultCache::insert(const PricingKey& key, const MCStats& stats)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (capacity_ == 0) return;
+
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            it->second->second = stats;
+            entries_.splice(entries_.begin(), entries_, it->second);
+            return;
+        }
+
+        entries_.emplace_front(key, stats);
+        index_[key] = entries_.begin();
+        evict();
+    }
+
+    void ResultCache::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        entries_.clear();
+        index_.clear();
+        hits_ = 0;
+        misses_ = 0;
+    }
+
+    void ResultCache::setCapacity(std::size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        capacity_ = capacity;
+        evict();
+    }
+
+    std::size_t ResultCache::capacity() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return capacity_;
+    }
+
+    std::size_t ResultCache::size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    std::uint64_t ResultCache::hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return hits_;
+    }
+
+    std::uint64_t ResultCache::misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return misses_;
+    }
+
+    void ResultCache::evict()
+    {
+        while (entries_.size() > capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+} // namespace opt
@@ -0,0 +1,108 @@
+#ifndef RESULTCACHE_H
+#define RESULTCACHE_H
+
+#include "Option.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace opt {
+
+    /**
+     * @brief Grandeur Monte Carlo mémorisée (prix ou grecque).
+     */
+    enum class CachedQuantity : int { Price = 0, Delta, Gamma, Theta, Rho, Vega };
+
+    /**
+     * @brief Clé canonique d'un calcul : option, grandeur, méthode et tous les arguments.
+     *
+     * Le moteur étant déterministe à graine fixée, deux clés égales donnent le même MCStats
+     * (configuration MCConfig fixée par les exports). Les zéros signés sont confondus (-0.0 == 0.0).
+     */
+    struct PricingKey {
+        int option = 0;                                  ///< Type d'option (ex. LookbackType).
+        CachedQuantity quantity = CachedQuantity::Price;
+        bool antithetic = false;
+        double S0 = 0.0;
+        double R = 0.0;
+        double sigma = 0.0;
+        double T0 = 0.0;
+        double T = 0.0;
+        int paths = 0;
+        int steps = 0;
+        std::uint64_t seed = 0;
+
+        bool operator==(const PricingKey& other) const;
+    };
+
+    /**
+     * @brief Hachage de PricingKey (combinaison splitmix64 des champs).
+     */
+    struct PricingKeyHash {
+        std::size_t operator()(const PricingKey& key) const;
+    };
+
+    /**
+     * @brief Cache LRU borné et thread-safe des résultats Monte Carlo.
+     *
+     * Au-delà de la capacité, l'entrée la moins récemment utilisée est évincée.
+     * Capacité 0 : cache désactivé (aucune entrée conservée, les recherches comptent des défauts).
+     */
+    class ResultCache {
+    public:
+        /// Capacité du cache partagé des exports.
+        static constexpr std::size_t kDefaultCapacity = 4096;
+
+        explicit ResultCache(std::size_t capacity = kDefaultCapacity);
+
+        /**
+         * @brief Cache partagé des exports.
+         */
+        static ResultCache& instance();
+
+        /**
+         * @brief Recherche @p key ; en cas de succès, copie le résultat et marque l'entrée récente.
+         * @return true si trouvé (compté comme succès), false sinon (compté comme défaut).
+         */
+        bool find(const PricingKey& key, MCStats& stats);
+
+        /**
+         * @brief Insère ou remplace le résultat de @p key (évince au besoin l'entrée la plus ancienne).
+         */
+        void insert(const PricingKey& key, const MCStats& stats);
+
+        /**
+         * @brief Vide le cache et remet les compteurs à zéro.
+         */
+        void clear();
+
+        /**
+         * @brief Change la capacité (évince immédiatement le surplus).
+         */
+        void setCapacity(std::size_t capacity);
+
+        std::size_t capacity() const;
+        std::size_t size() const;
+        std::uint64_t hits() const;
+        std::uint64_t misses() const;
+
+    private:
+        using Entry = std::pair<PricingKey, MCStats>;
+
+        void evict();
+
+        mutable std::mutex mutex_;
+        std::size_t capacity_;
+        std::list<Entry> entries_;   ///< Du plus récent au plus ancien.
+        std::unordered_map<PricingKey, std::list<Entry>::iterator, PricingKeyHash> index_;
+        std::uint64_t hits_ = 0;
+        std::uint64_t misses_ = 0;
+    };
+
+} // namespace opt
+
+#endif // RESULTCACHE_H
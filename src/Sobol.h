@@ -0,0 +1,47 @@
+#ifndef SOBOL_H
+#define SOBOL_H
+
+#include <cstdint>
+#include <vector>
+
+namespace opt {
+
+    /// Nombre de dimensions des nombres de direction embarqués (Joe & Kuo, new-joe-kuo-6.21201).
+    constexpr int kSobolMaxDims = 1024;
+
+    /**
+     * @brief Suite de Sobol en base 2 (nombres de direction de Joe & Kuo, 2008), points sur 32 bits.
+     *
+     * Le point d'indice i est calculé en O(dims * 32) par le code de Gray de i, puis les points
+     * suivants en O(dims) (Antonov & Saleev) : un bloc de trajectoires peut donc démarrer
+     * n'importe où dans la suite.
+     */
+    class SobolSequence {
+    public:
+        SobolSequence() : dims_(0), index_(0) {}
+
+        /**
+         * @brief Positionne la suite sur le point @p index en dimension @p dims.
+         *
+         * @throws std::invalid_argument si dims n'est pas dans [1, kSobolMaxDims] ou index >= 2^32.
+         */
+        void reset(int dims, std::uint64_t index);
+
+        /// Dimension (0 tant que reset n'a pas été appelé).
+        int dims() const { return dims_; }
+
+        /// Coordonnées entières du point courant (u_d = x_d / 2^32).
+        const std::uint32_t* current() const { return x_.data(); }
+
+        /// Passe au point suivant.
+        void advance();
+
+    private:
+        int dims_;
+        std::uint64_t index_;
+        std::vector<std::uint32_t> x_;
+    };
+
+} // namespace opt
+
+#endif // SOBOL_H
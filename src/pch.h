@@ -0,0 +1,17 @@
+// pch.h : en-tête précompilé.
+// Sous Windows, inclut les en-têtes système de la DLL (framework.h) ; ailleurs (benchmarks,
+// build Linux), seulement les en-têtes standard communs.
+
+#ifndef PCH_H
+#define PCH_H
+
+#ifdef _WIN32
+#include "framework.h"
+#endif
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#endif //PCH_H
@@ -0,0 +1,47 @@
+#ifndef TESTUTIL_H
+#define TESTUTIL_H
+
+/**
+ * @file TestUtil.h
+ * @brief Assertions minimales des tests (un exécutable par fichier, code de sortie != 0 en échec).
+ */
+
+#include <cmath>
+#include <cstdio>
+
+namespace test {
+
+    /// Nombre d'assertions en échec dans l'exécutable.
+    inline int& failures() {
+        static int n = 0;
+        return n;
+    }
+
+    inline void fail(const char* file, int line, const char* expr) {
+        std::fprintf(stderr, "%s:%d: échec : %s\n", file, line, expr);
+        ++failures();
+    }
+
+    /// Code de sortie de main : 0 si toutes les assertions ont réussi.
+    inline int result() {
+        if (failures() == 0) std::printf("OK\n");
+        else std::fprintf(stderr, "%d assertion(s) en échec\n", failures());
+        return failures() == 0 ? 0 : 1;
+    }
+
+} // namespace test
+
+#define CHECK(cond) \
+    do { if (!(cond)) test::fail(__FILE__, __LINE__, #cond); } while (0)
+
+/// |a - b| <= tol, valeurs affichées en cas d'échec.
+#define CHECK_NEAR(a, b, tol)                                                           \
+    do {                                                                                \
+        const double a_ = (a), b_ = (b);                                                \
+        if (!(std::fabs(a_ - b_) <= (tol))) {                                           \
+            std::fprintf(stderr, "  %s = %.10g, %s = %.10g\n", #a, a_, #b, b_);         \
+            test::fail(__FILE__, __LINE__, "|" #a " - " #b "| <= " #tol);               \
+        }                                                                               \
+    } while (0)
+
+#endif // TESTUTIL_H
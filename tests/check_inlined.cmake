@@ -0,0 +1,32 @@
+# Vérifie qu'un objet ne contient aucune fonction membre (définie hors ligne ou appelée) des
+# payoffs à politique FloatingStrikePayoff / FixedStrikePayoff (operator(), eval, ...).
+# Les noms décorés (Itanium) de ces membres commencent par _ZN[K]3opt20FloatingStrikePayoffI
+# ou _ZN[K]3opt17FixedStrikePayoffI.
+#
+#   cmake -DNM=<nm> -DOBJECTS=<objet;...> -P check_inlined.cmake
+
+if(NOT NM OR NOT OBJECTS)
+    message(FATAL_ERROR "NM et OBJECTS sont requis.")
+endif()
+
+foreach(object IN LISTS OBJECTS)
+    execute_process(COMMAND "${NM}" "${object}"
+        OUTPUT_VARIABLE symbols RESULT_VARIABLE status)
+    if(NOT status EQUAL 0)
+        message(FATAL_ERROR "nm a échoué sur ${object}")
+    endif()
+
+    # Témoin : les noyaux sont bien présents dans l'objet (sinon le test ne prouve rien)
+    if(NOT symbols MATCHES "inlinePayoffLoop" OR NOT symbols MATCHES "5AsianINS_17FixedStrikePayoff")
+        message(FATAL_ERROR "${object} : noyaux instanciés introuvables.")
+    endif()
+
+    string(REGEX MATCHALL "_ZNK?3opt(20Floating|17Fixed)StrikePayoffI[A-Za-z0-9_]*" members "${symbols}")
+    if(members)
+        list(REMOVE_DUPLICATES members)
+        string(REPLACE ";" "\n" members "${members}")
+        message(FATAL_ERROR "Évaluation de payoff non inlinée dans ${object} :\n${members}")
+    endif()
+endforeach()
+
+message(STATUS "Payoffs entièrement inlinés.")
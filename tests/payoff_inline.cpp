@@ -0,0 +1,40 @@
+/**
+ * @file payoff_inline.cpp
+ * @brief Noyaux instanciés avec les payoffs à politique, compilés en objet (non lié).
+ *
+ * check_inlined.cmake inspecte la table des symboles de l'objet : aucun
+ * FloatingStrikePayoff / FixedStrikePayoff ::operator() ni ::eval ne doit y figurer,
+ * ni défini hors ligne ni appelé, l'évaluation étant entièrement inlinée dans les boucles.
+ */
+
+#include "Asian.h"
+
+double inlineFloatingCallPrice(int paths, int steps, std::uint64_t seed)
+{
+    opt::Asian<opt::FloatingCallPayoff, opt::LookMin> option(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FloatingCallPayoff(), opt::LookMin());
+    return option.priceMC(paths, steps, seed, true).estimate;
+}
+
+double inlineFixedCallPrice(int paths, int steps, std::uint64_t seed, double K)
+{
+    opt::Asian<opt::FixedCallPayoff, opt::LookMax> option(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FixedCallPayoff(K), opt::LookMax());
+    return option.priceMC(paths, steps, seed, true).estimate;
+}
+
+double inlineFixedPutRisk(int paths, int steps, std::uint64_t seed, double K)
+{
+    opt::Asian<opt::FixedPutPayoff, opt::LookMin> option(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FixedPutPayoff(K), opt::LookMin());
+    opt::MCConfig config;
+    config.greeks = opt::GreekMethod::Pathwise;
+    option.setConfig(config);
+    return option.riskMC(paths, steps, seed, true).gamma.estimate;
+}
+
+void inlinePayoffLoop(const double* S, const double* agg, double* out, int n, double K)
+{
+    const opt::FixedCallPayoff payoff(K);
+    for (int i = 0; i < n; ++i) out[i] = payoff(S[i], agg[i]);
+}
@@ -0,0 +1,70 @@
+/**
+ * @file test_adaptive.cpp
+ * @brief Prix à précision cible : arrêt à l'erreur standard visée, plafond de trajectoires,
+ * budget de temps, résultat égal à priceMC sur les trajectoires utilisées.
+ */
+
+#include "Asian.h"
+#include "TestUtil.h"
+
+#include <stdexcept>
+
+namespace {
+
+    using LookbackPut = opt::Asian<opt::FloatingPutPayoff, opt::LookMax>;
+
+    LookbackPut makePut(int threads) {
+        LookbackPut put(100.0, 0.05, 0.2, 0.0, 1.0, opt::FloatingPutPayoff(), opt::LookMax());
+        opt::MCConfig config;
+        config.threads = threads;
+        put.setConfig(config);
+        return put;
+    }
+
+    void testStopsAtTarget(bool antithetic) {
+        const LookbackPut put = makePut(2);
+        const opt::MCAdaptiveStats a = put.priceMCAdaptive(0.05, 1000000, 0.0, 20, 4, antithetic);
+        CHECK(a.converged);
+        CHECK(a.stats.stdError <= 0.05);
+        CHECK(a.paths > 0 && a.paths < 1000000);
+
+        // Tranches sur la grille des blocs : même résultat que priceMC avec ce nombre de trajectoires
+        const opt::MCStats direct = put.priceMC(static_cast<int>(a.paths), 20, 4, antithetic);
+        CHECK(a.stats.estimate == direct.estimate && a.stats.stdError == direct.stdError);
+    }
+
+    void testPathCap() {
+        const opt::MCAdaptiveStats a = makePut(0).priceMCAdaptive(1e-4, 5000, 0.0, 20, 4, false);
+        CHECK(!a.converged);
+        CHECK(a.paths == 5000);
+        CHECK(a.stats.stdError > 1e-4);
+    }
+
+    void testTimeBudget() {
+        // Budget épuisé dès la première tranche : arrêt sans atteindre la cible ni le plafond
+        const opt::MCAdaptiveStats a = makePut(1).priceMCAdaptive(1e-4, 100000000, 1e-9, 20, 4, false);
+        CHECK(!a.converged);
+        CHECK(a.paths > 0 && a.paths < 100000000);
+    }
+
+    void testInvalidArguments() {
+        const LookbackPut put = makePut(0);
+        int thrown = 0;
+        try { put.priceMCAdaptive(0.0, 1000, 0.0, 20, 4, false); }
+        catch (const std::invalid_argument&) { ++thrown; }
+        try { put.priceMCAdaptive(0.1, 0, 0.0, 20, 4, false); }
+        catch (const std::invalid_argument&) { ++thrown; }
+        CHECK(thrown == 2);
+    }
+
+} // namespace
+
+int main()
+{
+    testStopsAtTarget(false);
+    testStopsAtTarget(true);
+    testPathCap();
+    testTimeBudget();
+    testInvalidArguments();
+    return test::result();
+}
@@ -0,0 +1,63 @@
+/**
+ * @file test_adjoint.cpp
+ * @brief Grecques adjointes (bande + balayage arrière) : égales aux grecques pathwise aux
+ * arrondis près, proches des différences finies sur les mêmes tirages, en séquentiel et en parallèle.
+ */
+
+#include "Asian.h"
+#include "TestUtil.h"
+
+#include <cmath>
+
+namespace {
+
+    const int paths = 20000, steps = 50;
+    const std::uint64_t seed = 5;
+
+    template <typename TOption>
+    opt::MCRisk risk(TOption option, opt::GreekMethod greeks, int threads) {
+        opt::MCConfig config;
+        config.greeks = greeks;
+        config.threads = threads;
+        option.setConfig(config);
+        return option.riskMC(paths, steps, seed, true);
+    }
+
+    void checkSame(const opt::MCStats& a, const opt::MCStats& b) {
+        CHECK_NEAR(a.estimate, b.estimate, 1e-10 * std::fabs(b.estimate) + 1e-12);
+        CHECK_NEAR(a.stdError, b.stdError, 1e-8 * b.stdError + 1e-12);
+    }
+
+    template <typename TOption>
+    void testMatchesPathwiseAndFiniteDifferences(const TOption& option, int threads) {
+        const opt::MCRisk adj = risk(option, opt::GreekMethod::Adjoint, threads);
+        const opt::MCRisk pw = risk(option, opt::GreekMethod::Pathwise, threads);
+        const opt::MCRisk fd = risk(option, opt::GreekMethod::FiniteDifference, threads);
+
+        checkSame(adj.price, pw.price);
+        checkSame(adj.delta, pw.delta);
+        checkSame(adj.gamma, pw.gamma);
+        checkSame(adj.theta, pw.theta);
+        checkSame(adj.rho, pw.rho);
+        checkSame(adj.vega, pw.vega);
+
+        const opt::MCStats* a[] = { &adj.delta, &adj.theta, &adj.rho, &adj.vega };
+        const opt::MCStats* f[] = { &fd.delta, &fd.theta, &fd.rho, &fd.vega };
+        for (int k = 0; k < 4; ++k)
+            CHECK(std::fabs(a[k]->estimate - f[k]->estimate) < 0.1 * f[k]->stdError + 1e-6);
+    }
+
+} // namespace
+
+int main()
+{
+    const opt::Asian<opt::FloatingPutPayoff, opt::LookMax> put(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FloatingPutPayoff(), opt::LookMax());
+    const opt::Asian<opt::FixedCallPayoff, opt::LookMax> fixedCall(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FixedCallPayoff(105.0), opt::LookMax());
+
+    testMatchesPathwiseAndFiniteDifferences(put, 0);
+    testMatchesPathwiseAndFiniteDifferences(put, 3);
+    testMatchesPathwiseAndFiniteDifferences(fixedCall, 0);
+    return test::result();
+}
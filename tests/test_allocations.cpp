@@ -0,0 +1,118 @@
+/**
+ * @file test_allocations.cpp
+ * @brief Régime permanent sans allocation : le nombre d'allocations d'un calcul ne dépend pas
+ * du nombre de trajectoires (mémoires de travail réutilisées d'une trajectoire à l'autre).
+ *
+ * operator new global compteur ; chaque configuration est d'abord exécutée une fois avec le
+ * plus grand nombre de trajectoires (croissance des capacités thread_local, ex. bande AAD),
+ * puis comptée à paths et 4 x paths. Moteur séquentiel : nombres égaux. Moteur multi-thread :
+ * la mémoire de travail d'un thread est allouée à sa première tâche, qui dépend de
+ * l'ordonnancement ; l'écart toléré (kWorkerSlack) reste inférieur au nombre de blocs ajoutés.
+ */
+
+#include "Aggregator.h"
+#include "Asian.h"
+#include "Payoff.h"
+#include "TestUtil.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+    std::atomic<long> g_allocations{ 0 };
+}
+
+void* operator new(std::size_t size)
+{
+    ++g_allocations;
+    if (void* p = std::malloc(size != 0 ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+    using LookbackCall = opt::Asian<opt::FloatingCallPayoff, opt::LookMin>;
+
+    const int paths = 1 << 15;   // 2^15 : 4 blocs de 4096 paires antithétiques (>= threads)
+    const int steps = 8;
+    const int threads = 4;
+
+    /// Écart toléré en multi-thread : 3 vecteurs de travail par thread (4 x paths : 12 blocs de plus).
+    const long kWorkerSlack = 3 * (threads - 1);
+
+    enum class Measure { Price, Delta, Risk };
+
+    long allocationsOf(const opt::MCConfig& config, Measure measure, int n) {
+        LookbackCall option(100.0, 0.05, 0.2, 0.0, 1.0, opt::FloatingCallPayoff(), opt::LookMin());
+        option.setConfig(config);
+
+        const long before = g_allocations;
+        if (measure == Measure::Price) option.priceMC(n, steps, 7, true);
+        else if (measure == Measure::Delta) option.deltaMC(n, steps, 7, true);
+        else option.riskMC(n, steps, 7, true);
+        return g_allocations - before;
+    }
+
+    void checkSteadyState(const char* name, const opt::MCConfig& config, Measure measure) {
+        allocationsOf(config, measure, 4 * paths);
+        const long small = allocationsOf(config, measure, paths);
+        const long large = allocationsOf(config, measure, 4 * paths);
+        const long slack = (config.threads > 0) ? kWorkerSlack : 0;
+        if (std::labs(large - small) > slack || large > 64)
+            std::fprintf(stderr, "  %s : %ld allocations (%d trajectoires), %ld (%d)\n", name, small, paths, large, 4 * paths);
+        CHECK(std::labs(large - small) <= slack);
+        CHECK(large <= 64);
+    }
+
+} // namespace
+
+int main()
+{
+    for (Measure measure : { Measure::Price, Measure::Delta, Measure::Risk }) {
+        opt::MCConfig config;
+        checkSteadyState("séquentiel", config, measure);
+
+        config.threads = threads;
+        checkSteadyState("4 threads", config, measure);
+
+        config.rng = opt::RngKind::Philox;
+        checkSteadyState("Philox, 4 threads", config, measure);
+
+        config = opt::MCConfig();
+        config.logSpace = true;
+        checkSteadyState("log-prix", config, measure);
+
+        config = opt::MCConfig();
+        config.bridgeCorrection = true;
+        checkSteadyState("correction de pont", config, measure);
+
+        config = opt::MCConfig();
+        config.greeks = opt::GreekMethod::Pathwise;
+        checkSteadyState("pathwise", config, measure);
+
+        config.greeks = opt::GreekMethod::Adjoint;
+        checkSteadyState("adjoint", config, measure);
+
+        config = opt::MCConfig();
+        config.fusedAntithetic = true;
+        config.threads = threads;
+        checkSteadyState("antithétiques fusionnées", config, measure);
+    }
+
+    opt::MCConfig batched;
+    batched.kernel = opt::PathKernel::Batched;
+    batched.threads = threads;
+    checkSteadyState("noyau SoA", batched, Measure::Price);
+
+    // Référence asymptotique (paramètres fixes) : allocations en nombre borné
+    LookbackCall option(100.0, 0.05, 0.2, 0.0, 1.0, opt::FloatingCallPayoff(), opt::LookMin());
+    const long before = g_allocations;
+    option.priceMC_BrownianBridge_Asymptotic();
+    CHECK(g_allocations - before <= 16);
+
+    return test::result();
+}
@@ -0,0 +1,70 @@
+/**
+ * @file test_analytic.cpp
+ * @brief Formule fermée du lookback flottant : valeurs de référence (Hull), grecques exactes
+ * contre différences finies de la formule, convergence du Monte Carlo à surveillance continue.
+ */
+
+#include "Asian.h"
+#include "TestUtil.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+    using Price = double (*)(double, double, double, double, double);
+    using Risk = opt::AnalyticRisk (*)(double, double, double, double, double);
+
+    void testReferenceValues() {
+        // Hull, Options, Futures and Other Derivatives : S0 = 50, sigma = 40 %, r = 10 %, T = 3 mois
+        CHECK_NEAR(opt::lookbackFloatingCallAnalytic(50.0, 0.1, 0.4, 0.0, 0.25), 8.04, 0.005);
+        CHECK_NEAR(opt::lookbackFloatingPutAnalytic(50.0, 0.1, 0.4, 0.0, 0.25), 7.79, 0.005);
+    }
+
+    void testGreeksMatchFiniteDifferences(Price price, Risk risk) {
+        const double S0 = 100.0, R = 0.05, sigma = 0.25, T0 = 0.1, T = 1.0, h = 1e-5;
+        const opt::AnalyticRisk r = risk(S0, R, sigma, T0, T);
+
+        CHECK_NEAR(r.price, price(S0, R, sigma, T0, T), 1e-12 * r.price);   // arithmétique duale : arrondis
+        CHECK_NEAR(r.delta, r.price / S0, 1e-14);
+        CHECK(r.gamma == 0.0);
+
+        const double delta = (price(S0 * (1 + h), R, sigma, T0, T) - price(S0 * (1 - h), R, sigma, T0, T)) / (2 * h * S0);
+        const double theta = (price(S0, R, sigma, T0 + h, T) - price(S0, R, sigma, T0 - h, T)) / (2 * h);
+        const double rho = (price(S0, R + h, sigma, T0, T) - price(S0, R - h, sigma, T0, T)) / (2 * h);
+        const double vega = (price(S0, R, sigma + h, T0, T) - price(S0, R, sigma - h, T0, T)) / (2 * h);
+        CHECK_NEAR(r.delta, delta, 1e-7);
+        CHECK_NEAR(r.theta, theta, 1e-5 * std::fabs(theta));
+        CHECK_NEAR(r.rho, rho, 1e-5 * std::fabs(rho));
+        CHECK_NEAR(r.vega, vega, 1e-5 * std::fabs(vega));
+    }
+
+    void testMonteCarloConverges() {
+        // Correction de pont brownien : surveillance continue, même contrat que la formule fermée
+        opt::Asian<opt::FloatingCallPayoff, opt::LookMin> call(100.0, 0.05, 0.2, 0.0, 1.0,
+            opt::FloatingCallPayoff(), opt::LookMin());
+        opt::MCConfig config;
+        config.bridgeCorrection = true;
+        call.setConfig(config);
+        const opt::MCStats mc = call.priceMC(40000, 16, 21, true);
+        CHECK_NEAR(mc.estimate, opt::lookbackFloatingCallAnalytic(100.0, 0.05, 0.2, 0.0, 1.0), 4.0 * mc.stdError);
+    }
+
+    void testInvalidArguments() {
+        bool thrown = false;
+        try { opt::lookbackFloatingPutAnalytic(100.0, 0.05, 0.0, 0.0, 1.0); }
+        catch (const std::invalid_argument&) { thrown = true; }
+        CHECK(thrown);
+    }
+
+} // namespace
+
+int main()
+{
+    testReferenceValues();
+    testGreeksMatchFiniteDifferences(&opt::lookbackFloatingCallAnalytic, &opt::lookbackFloatingCallRiskAnalytic);
+    testGreeksMatchFiniteDifferences(&opt::lookbackFloatingPutAnalytic, &opt::lookbackFloatingPutRiskAnalytic);
+    testMonteCarloConverges();
+    testInvalidArguments();
+    return test::result();
+}
@@ -0,0 +1,182 @@
+/**
+ * @file test_async_pricer.cpp
+ * @brief File de calculs asynchrones : résultats identiques au calcul synchrone, annulation,
+ * échec, collecte et éviction des jobs terminés non collectés, tampon de opt_async_collect.
+ */
+
+#include "AsyncPricer.h"
+#include "Exports.h"
+#include "TestUtil.h"
+
+#include <chrono>
+#include <cmath>
+#include <future>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+    /// Attend la fin du job (Done / Failed), ou Unknown ; abandon après 60 s.
+    opt::JobStatus waitFinished(const opt::AsyncPricer& pricer, std::int64_t id) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+        for (;;) {
+            const opt::JobStatus s = pricer.status(id);
+            if (s != opt::JobStatus::Pending && s != opt::JobStatus::Running) return s;
+            if (std::chrono::steady_clock::now() > deadline) return s;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    opt::LookbackJob makeJob(opt::LookbackType type, opt::JobMeasure measure) {
+        opt::LookbackJob job;
+        job.type = type;
+        job.measure = measure;
+        job.S0 = 100.0;
+        job.R = 0.05;
+        job.sigma = 0.2;
+        job.T0 = 0.0;
+        job.T = 1.0;
+        job.paths = 5000;
+        job.steps = 20;
+        job.seed = 3;
+        job.antithetic = true;
+        return job;
+    }
+
+    void testMatchesSynchronous() {
+        opt::AsyncPricer pricer(2);
+        const opt::LookbackJob priceJob = makeJob(opt::LookbackType::Call, opt::JobMeasure::Price);
+        const opt::LookbackJob riskJob = makeJob(opt::LookbackType::Put, opt::JobMeasure::Risk);
+        const std::int64_t priceId = pricer.submit(priceJob);
+        const std::int64_t riskId = pricer.submit(riskJob);
+
+        opt::Asian<opt::FloatingCallPayoff, opt::LookMin> call(100.0, 0.05, 0.2, 0.0, 1.0,
+            opt::FloatingCallPayoff(), opt::LookMin());
+        opt::Asian<opt::FloatingPutPayoff, opt::LookMax> put(100.0, 0.05, 0.2, 0.0, 1.0,
+            opt::FloatingPutPayoff(), opt::LookMax());
+        const opt::MCStats price = call.priceMC(5000, 20, 3, true);
+        const opt::MCRisk risk = put.riskMC(5000, 20, 3, true);
+
+        std::vector<double> out;
+        std::string error;
+        CHECK(waitFinished(pricer, priceId) == opt::JobStatus::Done);
+        CHECK(pricer.collect(priceId, out, error) == opt::JobStatus::Done);
+        CHECK(out.size() == 4);
+        CHECK(out.size() == 4 && out[0] == price.estimate && out[1] == price.stdError
+            && out[2] == price.ciLow && out[3] == price.ciHigh);
+
+        CHECK(waitFinished(pricer, riskId) == opt::JobStatus::Done);
+        CHECK(pricer.resultSize(riskId) == 24);
+        CHECK(pricer.collect(riskId, out, error) == opt::JobStatus::Done);
+        CHECK(out.size() == 24);
+        CHECK(out.size() == 24 && out[0] == risk.price.estimate && out[4] == risk.delta.estimate
+            && out[8] == risk.gamma.estimate && out[12] == risk.theta.estimate
+            && out[16] == risk.rho.estimate && out[20] == risk.vega.estimate && out[21] == risk.vega.stdError);
+
+        // Collecte unique
+        CHECK(pricer.collect(priceId, out, error) == opt::JobStatus::Unknown);
+        CHECK(pricer.jobs() == 0);
+    }
+
+    void testCancelAndPendingCollect() {
+        opt::AsyncPricer pricer(1);
+        std::promise<void> release;
+        std::shared_future<void> gate = release.get_future().share();
+
+        const std::int64_t blocker = pricer.submit([gate]() { gate.wait(); return std::vector<double>{ 1.0 }; });
+        const std::int64_t queued = pricer.submit(makeJob(opt::LookbackType::Call, opt::JobMeasure::Price));
+        const std::int64_t cancelled = pricer.submit([]() { return std::vector<double>{ 2.0 }; });
+
+        std::vector<double> out;
+        std::string error;
+        CHECK(pricer.collect(queued, out, error) == opt::JobStatus::Pending);   // non libéré
+        CHECK(pricer.resultSize(queued) == 0);
+        CHECK(pricer.cancel(cancelled));
+        CHECK(pricer.status(cancelled) == opt::JobStatus::Unknown);
+        CHECK(!pricer.cancel(cancelled));
+        CHECK(pricer.jobs() == 2);
+
+        release.set_value();
+        CHECK(waitFinished(pricer, blocker) == opt::JobStatus::Done);
+        CHECK(!pricer.cancel(blocker));   // terminé : plus annulable
+        CHECK(pricer.collect(blocker, out, error) == opt::JobStatus::Done && out.size() == 1 && out[0] == 1.0);
+        CHECK(waitFinished(pricer, queued) == opt::JobStatus::Done);
+        CHECK(pricer.collect(queued, out, error) == opt::JobStatus::Done && out.size() == 4);
+    }
+
+    void testFailure() {
+        opt::AsyncPricer pricer(1);
+        const std::int64_t id = pricer.submit([]() -> std::vector<double> {
+            throw std::runtime_error("échec volontaire");
+            });
+
+        std::vector<double> out;
+        std::string error;
+        CHECK(waitFinished(pricer, id) == opt::JobStatus::Failed);
+        CHECK(pricer.collect(id, out, error) == opt::JobStatus::Failed);
+        CHECK(error == "échec volontaire");
+        CHECK(out.empty());
+        CHECK(pricer.jobs() == 0);
+
+        // Paramètres invalides : erreur à la soumission
+        opt::LookbackJob job = makeJob(opt::LookbackType::Call, opt::JobMeasure::Price);
+        job.sigma = -1.0;
+        bool thrown = false;
+        try { pricer.submit(job); }
+        catch (const std::invalid_argument&) { thrown = true; }
+        CHECK(thrown);
+        CHECK(pricer.jobs() == 0);
+    }
+
+    void testEvictsOldestFinished() {
+        opt::AsyncPricer pricer(1, 2);
+        std::int64_t ids[4];
+        for (int i = 0; i < 4; ++i)
+            ids[i] = pricer.submit([i]() { return std::vector<double>{ static_cast<double>(i) }; });
+        CHECK(waitFinished(pricer, ids[3]) == opt::JobStatus::Done);
+
+        // Un seul thread : terminés dans l'ordre, les deux plus anciens sont évincés
+        CHECK(pricer.jobs() == 2);
+        CHECK(pricer.status(ids[0]) == opt::JobStatus::Unknown);
+        CHECK(pricer.status(ids[1]) == opt::JobStatus::Unknown);
+
+        std::vector<double> out;
+        std::string error;
+        CHECK(pricer.collect(ids[2], out, error) == opt::JobStatus::Done && out.size() == 1 && out[0] == 2.0);
+
+        pricer.setMaxFinished(0);
+        CHECK(pricer.jobs() == 0);
+        CHECK(pricer.status(ids[3]) == opt::JobStatus::Unknown);
+    }
+
+    void testExportCollectBufferTooSmall() {
+        const double id = opt_async_lb_submit(1, 1, 100.0, 0.05, 0.2, 0.0, 1.0, 2000, 20, 5, 1);
+        // Pool de la DLL (distinct de celui de lookback_core) : attente par opt_async_status
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(60);
+        while (opt_async_status(id) < 2.0 && std::chrono::steady_clock::now() < deadline)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        CHECK(opt_async_status(id) == 2.0);
+
+        // Job Risk (24 doubles) : tampon de 4 refusé, job conservé puis collecté en entier
+        double out[24] = {};
+        opt_clear_last_error();
+        CHECK(std::isnan(opt_async_collect(id, out, 4)));
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+        CHECK(opt_async_status(id) == 2.0);
+
+        const double price = opt_async_collect(id, out, 24);
+        CHECK(price == out[0] && !std::isnan(out[23]) && out[23] > 0.0);
+        CHECK(opt_async_status(id) == -1.0);
+    }
+
+} // namespace
+
+int main()
+{
+    testMatchesSynchronous();
+    testCancelAndPendingCollect();
+    testFailure();
+    testEvictsOldestFinished();
+    testExportCollectBufferTooSmall();
+    return test::result();
+}
@@ -0,0 +1,51 @@
+/**
+ * @file test_batched.cpp
+ * @brief Noyau vectorisé (PathKernel::Batched) : mêmes tirages que le moteur scalaire, prix égal
+ * aux arrondis de l'exponentielle près, y compris pour un nombre de trajectoires non multiple
+ * de kSimdLanes.
+ */
+
+#include "Asian.h"
+#include "TestUtil.h"
+
+#include <cmath>
+
+namespace {
+
+    const int steps = 30;
+
+    template <typename TOption>
+    void testMatchesScalar(TOption option, int paths, bool antithetic, int threads, bool logSpace) {
+        opt::MCConfig config;
+        config.threads = threads;
+        config.logSpace = logSpace;
+        option.setConfig(config);
+        const opt::MCStats scalar = option.priceMC(paths, steps, 17, antithetic);
+
+        config.kernel = opt::PathKernel::Batched;
+        option.setConfig(config);
+        const opt::MCStats batched = option.priceMC(paths, steps, 17, antithetic);
+
+        CHECK_NEAR(batched.estimate, scalar.estimate, 1e-11 * scalar.estimate);
+        CHECK_NEAR(batched.stdError, scalar.stdError, 1e-9 * scalar.stdError);
+    }
+
+} // namespace
+
+int main()
+{
+    const opt::Asian<opt::FloatingCallPayoff, opt::LookMin> call(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FloatingCallPayoff(), opt::LookMin());
+    const opt::Asian<opt::FloatingPutPayoff, opt::LookMax> put(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FloatingPutPayoff(), opt::LookMax());
+
+    for (int paths : { opt::kSimdLanes, 5003 }) {
+        for (bool antithetic : { false, true }) {
+            testMatchesScalar(call, paths, antithetic, 0, false);
+            testMatchesScalar(put, paths, antithetic, 0, true);
+        }
+    }
+    testMatchesScalar(call, 9001, true, 2, false);
+    testMatchesScalar(put, 9001, false, 3, true);
+    return test::result();
+}
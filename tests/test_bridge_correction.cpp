@@ -0,0 +1,51 @@
+/**
+ * @file test_bridge_correction.cpp
+ * @brief Correction de pont brownien : prix et grecques à surveillance continue quel que soit
+ * steps (formule fermée), là où le moteur discret garde un biais de discrétisation.
+ */
+
+#include "Exports.h"
+#include "TestUtil.h"
+
+#include <cmath>
+
+namespace {
+
+    const double S0 = 100.0, R = 0.05, sigma = 0.2, T0 = 0.0, T = 1.0;
+    const int paths = 40000;
+    const std::uint64_t seed = 19;
+
+    void testPriceContinuousForAnySteps(bool call) {
+        auto bb = call ? &opt_lb_call_price_mc_vr_bb_full : &opt_lb_put_price_mc_vr_bb_full;
+        auto discrete = call ? &opt_lb_call_price_mc_vr_full : &opt_lb_put_price_mc_vr_full;
+        const double exact = call ? opt_lb_call_price_analytic(S0, R, sigma, T0, T)
+            : opt_lb_put_price_analytic(S0, R, sigma, T0, T);
+
+        double out[4];
+        for (int steps : { 4, 32 }) {
+            CHECK(!std::isnan(bb(S0, R, sigma, T0, T, paths, steps, seed, out)));
+            CHECK_NEAR(out[0], exact, 4.0 * out[1]);
+        }
+
+        // Quatre dates d'observation : extrême discret nettement en retrait du continu
+        CHECK(!std::isnan(discrete(S0, R, sigma, T0, T, paths, 4, seed, out)));
+        CHECK(std::fabs(exact - out[0]) > 10.0 * out[1]);
+    }
+
+    void testGreeksContinuous() {
+        double risk[24];
+        CHECK(!std::isnan(opt_lb_put_risk_mc_vr_bb(S0, R, sigma, T0, T, paths, 8, seed, risk)));
+        CHECK_NEAR(risk[4], opt_lb_put_delta_analytic(S0, R, sigma, T0, T), 4.0 * risk[5] + 1e-6);
+        CHECK_NEAR(risk[16], opt_lb_put_rho_analytic(S0, R, sigma, T0, T), 4.0 * risk[17]);
+        CHECK_NEAR(risk[20], opt_lb_put_vega_analytic(S0, R, sigma, T0, T), 4.0 * risk[21]);
+    }
+
+} // namespace
+
+int main()
+{
+    testPriceContinuousForAnySteps(true);
+    testPriceContinuousForAnySteps(false);
+    testGreeksContinuous();
+    return test::result();
+}
@@ -0,0 +1,61 @@
+/**
+ * @file test_control_variate.cpp
+ * @brief Variables de contrôle de priceMC : erreur standard réduite sur les mêmes paramètres,
+ * prix compatible avec l'estimateur brut.
+ */
+
+#include "Asian.h"
+#include "TestUtil.h"
+
+#include <cmath>
+
+namespace {
+
+    const int paths = 20000, steps = 32;
+
+    template <typename TOption>
+    opt::MCStats price(TOption option, opt::ControlVariate control, bool antithetic, int threads = 0) {
+        opt::MCConfig config;
+        config.control = control;
+        config.threads = threads;
+        option.setConfig(config);
+        return option.priceMC(paths, steps, 13, antithetic);
+    }
+
+    template <typename TOption>
+    void testReducesVariance(const TOption& option, opt::ControlVariate control, double minRatio) {
+        for (bool antithetic : { false, true }) {
+            const opt::MCStats plain = price(option, opt::ControlVariate::None, antithetic);
+            const opt::MCStats cv = price(option, control, antithetic);
+
+            CHECK(std::isfinite(cv.stdError) && cv.stdError > 0.0);
+            CHECK(plain.stdError / cv.stdError > minRatio);
+            CHECK_NEAR(cv.estimate, plain.estimate, 4.0 * plain.stdError);
+            CHECK(cv.ciLow < cv.estimate && cv.estimate < cv.ciHigh);
+        }
+    }
+
+    void testThreadsIndependent() {
+        opt::Asian<opt::FloatingPutPayoff, opt::LookMax> put(100.0, 0.05, 0.2, 0.0, 1.0,
+            opt::FloatingPutPayoff(), opt::LookMax());
+        const opt::MCStats one = price(put, opt::ControlVariate::ContinuousExtreme, true, 1);
+        const opt::MCStats three = price(put, opt::ControlVariate::ContinuousExtreme, true, 3);
+        CHECK(one.estimate == three.estimate && one.stdError == three.stdError);
+    }
+
+} // namespace
+
+int main()
+{
+    const opt::Asian<opt::FloatingCallPayoff, opt::LookMin> call(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FloatingCallPayoff(), opt::LookMin());
+    const opt::Asian<opt::FloatingPutPayoff, opt::LookMax> put(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FloatingPutPayoff(), opt::LookMax());
+
+    // Lookback continu : contrôle très corrélé ; moyenne géométrique : réduction plus modeste
+    testReducesVariance(call, opt::ControlVariate::ContinuousExtreme, 4.0);
+    testReducesVariance(put, opt::ControlVariate::ContinuousExtreme, 4.0);
+    testReducesVariance(call, opt::ControlVariate::GeometricAverage, 1.1);
+    testThreadsIndependent();
+    return test::result();
+}
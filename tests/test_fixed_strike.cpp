@@ -0,0 +1,98 @@
+/**
+ * @file test_fixed_strike.cpp
+ * @brief Lookbacks à strike fixe : C ABI, gamma non homogène (pathwise / adjoint contre
+ * différences finies) et scenarioMC par spot.
+ */
+
+#include "Exports.h"
+#include "TestUtil.h"
+
+#include <vector>
+
+namespace {
+
+    const double S0 = 100.0, R = 0.05, sigma = 0.2, T0 = 0.0, T = 1.0;
+    const int paths = 40000, steps = 50;
+    const std::uint64_t seed = 11;
+
+    // Évaluation constexpr, opérateur scalaire noexcept
+    constexpr opt::FixedCallPayoff kCall(100.0);
+    static_assert(kCall(0.0, 110.0) == 10.0, "max - K");
+    static_assert(kCall(0.0, 90.0) == 0.0, "hors de la monnaie");
+    static_assert(opt::FixedPutPayoff(100.0)(0.0, 90.0) == 10.0, "K - min");
+    static_assert(opt::FloatingCallPayoff()(110.0, 95.0) == 15.0, "S_T - min");
+    static_assert(noexcept(kCall(0.0, 1.0)), "évaluation sans exception");
+    static_assert(noexcept(opt::FloatingPutPayoff()(1.0, 2.0)), "évaluation sans exception");
+    static_assert(opt::FixedCallPayoff::homogeneityDegree < 0, "strike fixe : non homogène");
+
+    void testRiskMethodsAgree(bool call, double K) {
+        auto risk = call ? &opt_lb_fixed_call_risk_mc : &opt_lb_fixed_put_risk_mc;
+        double fd[24], pw[24], adj[24];
+        CHECK(!std::isnan(risk(S0, R, sigma, T0, T, K, paths, steps, seed, 1, 0, fd)));
+        CHECK(!std::isnan(risk(S0, R, sigma, T0, T, K, paths, steps, seed, 1, 1, pw)));
+        CHECK(!std::isnan(risk(S0, R, sigma, T0, T, K, paths, steps, seed, 1, 2, adj)));
+
+        // Mêmes tirages : mêmes prix (aux arrondis de l'arithmétique duale), grecques proches
+        CHECK_NEAR(pw[0], fd[0], 1e-10 * fd[0]);
+        CHECK_NEAR(adj[0], fd[0], 1e-10 * fd[0]);
+        CHECK_NEAR(pw[4], fd[4], 0.01 * std::fabs(fd[4]) + 1e-4);   // delta
+        CHECK_NEAR(pw[8], fd[8], 0.05 * std::fabs(fd[8]) + 1e-4);   // gamma
+        CHECK_NEAR(adj[4], pw[4], 1e-10);
+        CHECK_NEAR(adj[8], pw[8], 1e-10);
+        CHECK(pw[8] > 0.0);
+    }
+
+    void testPriceMatchesEngine() {
+        double out[4];
+        const double K = 105.0;
+        const double price = opt_lb_fixed_call_price_mc(S0, R, sigma, T0, T, K, paths, steps, seed, 1, out);
+
+        // Exports : antithétiques fusionnés, égaux au moteur non fusionné aux arrondis près
+        opt::Asian<opt::FixedCallPayoff, opt::LookMax> option(S0, R, sigma, T0, T, opt::FixedCallPayoff(K), opt::LookMax());
+        const opt::MCStats unfused = option.priceMC(paths, steps, seed, true);
+        opt::MCConfig config;
+        config.fusedAntithetic = true;
+        option.setConfig(config);
+        const opt::MCStats direct = option.priceMC(paths, steps, seed, true);
+        CHECK(price == direct.estimate);
+        CHECK(out[1] == direct.stdError);
+        CHECK_NEAR(price, unfused.estimate, 1e-10 * unfused.estimate);
+        CHECK_NEAR(out[1], unfused.stdError, 1e-8 * unfused.stdError);
+        CHECK(out[2] < price && price < out[3]);
+    }
+
+    void testScenarioPricesEachSpot() {
+        opt::Asian<opt::FixedPutPayoff, opt::LookMin> option(S0, R, sigma, T0, T, opt::FixedPutPayoff(95.0), opt::LookMin());
+        const std::vector<opt::MCScenario> scenarios = { { 90.0, R, sigma }, { 100.0, R, sigma }, { 110.0, R, 0.3 } };
+        const std::vector<opt::MCStats> sc = option.scenarioMC(scenarios, 20000, steps, seed, true);
+
+        for (std::size_t i = 0; i < scenarios.size(); ++i) {
+            opt::Asian<opt::FixedPutPayoff, opt::LookMin> direct(scenarios[i].S0, R, scenarios[i].sigma, T0, T,
+                opt::FixedPutPayoff(95.0), opt::LookMin());
+            CHECK_NEAR(sc[i].estimate, direct.priceMC(20000, steps, seed, true).estimate, 1e-12);
+        }
+    }
+
+    void testInvalidStrikeReported() {
+        double out[4];
+        CHECK(std::isnan(opt_lb_fixed_call_price_mc(S0, R, sigma, T0, T, -1.0, paths, steps, seed, 0, out)));
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+        CHECK(std::isnan(opt_lb_fixed_put_price_mc(S0, R, sigma, T0, T, std::nan(""), paths, steps, seed, 0, out)));
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+
+        double risk[24];
+        CHECK(std::isnan(opt_lb_fixed_call_risk_mc(S0, R, sigma, T0, T, 100.0, paths, steps, seed, 0, 3, risk)));
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+    }
+
+} // namespace
+
+int main()
+{
+    testRiskMethodsAgree(true, 110.0);
+    testRiskMethodsAgree(false, 95.0);
+    testPriceMatchesEngine();
+    testScenarioPricesEachSpot();
+    testInvalidStrikeReported();
+    return test::result();
+}
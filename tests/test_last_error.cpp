@@ -0,0 +1,74 @@
+/**
+ * @file test_last_error.cpp
+ * @brief API d'erreur des exports : code, message et source du dernier appel, propres à chaque
+ * thread, remis à OPT_OK par l'appel suivant ; copie tronquée des chaînes.
+ */
+
+#include "Exports.h"
+#include "TestUtil.h"
+
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <thread>
+
+namespace {
+
+    const double S0 = 100.0, R = 0.05, sigma = 0.2, T0 = 0.0, T = 1.0;
+
+    void testSuccessClearsError() {
+        CHECK(std::isnan(opt_lb_call_price_mc(S0, R, -sigma, T0, T, 1000, 10, 1)));
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+
+        CHECK(!std::isnan(opt_lb_call_price_mc(S0, R, sigma, T0, T, 1000, 10, 1)));
+        CHECK(opt_last_error_code() == OPT_OK);
+        char buffer[8] = "x";
+        CHECK(opt_last_error_message(buffer, sizeof(buffer)) == 0 && buffer[0] == '\0');
+        CHECK(opt_last_error_source(nullptr, 0) == 0);
+    }
+
+    void testMessageAndSource() {
+        CHECK(std::isnan(opt_lb_put_price_mc_vr(S0, R, sigma, T0, T, 0, 10, 1)));
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+
+        // Longueur seule (tampon nul), puis copie complète
+        const int length = opt_last_error_message(nullptr, 0);
+        CHECK(length > 0);
+        std::string message(static_cast<std::size_t>(length) + 1, '?');
+        CHECK(opt_last_error_message(&message[0], length + 1) == length);
+        CHECK(std::strlen(message.c_str()) == static_cast<std::size_t>(length));
+
+        // Copie tronquée, toujours terminée par un zéro
+        char small[5];
+        CHECK(opt_last_error_message(small, sizeof(small)) == length);
+        CHECK(std::strlen(small) == 4 && std::strncmp(small, message.c_str(), 4) == 0);
+
+        char source[64];
+        CHECK(opt_last_error_source(source, sizeof(source)) == static_cast<int>(std::strlen("opt_lb_put_price_mc_vr")));
+        CHECK(std::strcmp(source, "opt_lb_put_price_mc_vr") == 0);
+
+        opt_clear_last_error();
+        CHECK(opt_last_error_code() == OPT_OK && opt_last_error_message(nullptr, 0) == 0);
+    }
+
+    void testThreadLocal() {
+        CHECK(std::isnan(opt_lb_call_price_mc(S0, R, sigma, T, T0, 1000, 10, 1)));   // T < T0
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+
+        int otherCode = -1;
+        std::thread other([&otherCode]() { otherCode = opt_last_error_code(); });
+        other.join();
+        CHECK(otherCode == OPT_OK);
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+        opt_clear_last_error();
+    }
+
+} // namespace
+
+int main()
+{
+    testSuccessClearsError();
+    testMessageAndSource();
+    testThreadLocal();
+    return test::result();
+}
@@ -0,0 +1,53 @@
+/**
+ * @file test_mlmc.cpp
+ * @brief Monte Carlo multi-niveaux : cible discrète (prix à steps dates, pas le prix continu),
+ * trajectoires finales tirées hors du pilote.
+ */
+
+#include "Exports.h"
+#include "TestUtil.h"
+
+#include <cmath>
+
+namespace {
+
+    const double S0 = 100.0, R = 0.05, sigma = 0.2, T0 = 0.0, T = 1.0;
+    const int steps = 64;
+
+    void testTargetsDiscretePrice(bool call) {
+        auto mlmc = call ? &opt_lb_call_price_mlmc : &opt_lb_put_price_mlmc;
+        auto analytic = call ? &opt_lb_call_price_analytic : &opt_lb_put_price_analytic;
+
+        double ml[6];
+        CHECK(!std::isnan(mlmc(S0, R, sigma, T0, T, 0.02, steps, 7, ml)));
+        CHECK(ml[1] < 0.03);
+        CHECK(ml[5] < steps);   // au moins un niveau de correction
+
+        opt::Asian<opt::FloatingCallPayoff, opt::LookMin> c(S0, R, sigma, T0, T, opt::FloatingCallPayoff(), opt::LookMin());
+        opt::Asian<opt::FloatingPutPayoff, opt::LookMax> p(S0, R, sigma, T0, T, opt::FloatingPutPayoff(), opt::LookMax());
+        const opt::MCStats mc = call ? c.priceMC(200000, steps, 8, true) : p.priceMC(200000, steps, 8, true);
+
+        // Même cible que priceMC à steps dates...
+        CHECK(std::fabs(ml[0] - mc.estimate) < 4.0 * std::sqrt(ml[1] * ml[1] + mc.stdError * mc.stdError));
+        // ... sous le prix continu : biais de discrétisation ~ 0.58 sigma sqrt(dt) S0
+        CHECK(analytic(S0, R, sigma, T0, T) - ml[0] > 0.5);
+    }
+
+    void testFinalSamplesIndependentOfPilot() {
+        // Cible large : N_l sous la taille du pilote ; seules les N_l trajectoires finales,
+        // tirées hors du pilote, entrent dans l'estimateur
+        opt::Asian<opt::FloatingCallPayoff, opt::LookMin> c(S0, R, sigma, T0, T, opt::FloatingCallPayoff(), opt::LookMin());
+        const opt::MCMultilevelStats ml = c.priceMLMC(1.0, steps, 7, false);
+        for (std::int64_t n : ml.paths) CHECK(n >= 64 && n < 2000);
+        CHECK(ml.stats.stdError > 0.0);
+    }
+
+} // namespace
+
+int main()
+{
+    testTargetsDiscretePrice(true);
+    testTargetsDiscretePrice(false);
+    testFinalSamplesIndependentOfPilot();
+    return test::result();
+}
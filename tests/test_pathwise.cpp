@@ -0,0 +1,79 @@
+/**
+ * @file test_pathwise.cpp
+ * @brief Grecques pathwise : égales aux différences finies sur les mêmes tirages (à l'erreur de
+ * bump près), gamma par homogénéité, grecques individuelles égales à celles de riskMC.
+ */
+
+#include "Asian.h"
+#include "TestUtil.h"
+
+#include <cmath>
+
+namespace {
+
+    const int paths = 20000, steps = 50;
+    const std::uint64_t seed = 3;
+
+    template <typename TOption>
+    opt::MCRisk risk(TOption option, opt::GreekMethod greeks) {
+        opt::MCConfig config;
+        config.greeks = greeks;
+        option.setConfig(config);
+        return option.riskMC(paths, steps, seed, true);
+    }
+
+    /// Même estimateur sur les mêmes tirages : écart de l'ordre du bump, bien sous l'erreur standard
+    void checkAgrees(const opt::MCStats& pw, const opt::MCStats& fd) {
+        CHECK_NEAR(pw.estimate, fd.estimate, 1e-3 * std::fabs(fd.estimate) + 1e-6);
+        CHECK(std::fabs(pw.estimate - fd.estimate) < 0.1 * fd.stdError + 1e-6);
+    }
+
+    template <typename TOption>
+    void testMatchesFiniteDifferences(const TOption& option) {
+        const opt::MCRisk fd = risk(option, opt::GreekMethod::FiniteDifference);
+        const opt::MCRisk pw = risk(option, opt::GreekMethod::Pathwise);
+
+        CHECK(pw.price.estimate == fd.price.estimate);
+        checkAgrees(pw.delta, fd.delta);
+        checkAgrees(pw.theta, fd.theta);
+        checkAgrees(pw.rho, fd.rho);
+        checkAgrees(pw.vega, fd.vega);
+    }
+
+    void testHomogeneousGamma() {
+        // Strike flottant, homogène de degré 1 : delta = P / S0, gamma nul trajectoire par trajectoire
+        opt::Asian<opt::FloatingCallPayoff, opt::LookMin> call(100.0, 0.05, 0.2, 0.0, 1.0,
+            opt::FloatingCallPayoff(), opt::LookMin());
+        const opt::MCRisk pw = risk(call, opt::GreekMethod::Pathwise);
+        CHECK_NEAR(pw.delta.estimate, pw.price.estimate / 100.0, 1e-12);
+        CHECK(pw.gamma.estimate == 0.0 && pw.gamma.stdError == 0.0);
+    }
+
+    void testIndividualGreeksMatchRisk() {
+        opt::Asian<opt::FloatingPutPayoff, opt::LookMax> put(100.0, 0.05, 0.2, 0.0, 1.0,
+            opt::FloatingPutPayoff(), opt::LookMax());
+        opt::MCConfig config;
+        config.greeks = opt::GreekMethod::Pathwise;
+        put.setConfig(config);
+
+        const opt::MCRisk r = put.riskMC(paths, steps, seed, true);
+        CHECK_NEAR(put.deltaMC(paths, steps, seed, true).estimate, r.delta.estimate, 1e-12);
+        CHECK_NEAR(put.thetaMC(paths, steps, seed, true).estimate, r.theta.estimate, 1e-10);
+        CHECK_NEAR(put.rhoMC(paths, steps, seed, true).estimate, r.rho.estimate, 1e-10);
+        CHECK_NEAR(put.vegaMC(paths, steps, seed, true).estimate, r.vega.estimate, 1e-10);
+    }
+
+} // namespace
+
+int main()
+{
+    testMatchesFiniteDifferences(opt::Asian<opt::FloatingCallPayoff, opt::LookMin>(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FloatingCallPayoff(), opt::LookMin()));
+    testMatchesFiniteDifferences(opt::Asian<opt::FloatingPutPayoff, opt::LookMax>(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FloatingPutPayoff(), opt::LookMax()));
+    testMatchesFiniteDifferences(opt::Asian<opt::FixedCallPayoff, opt::LookMax>(100.0, 0.05, 0.2, 0.0, 1.0,
+        opt::FixedCallPayoff(105.0), opt::LookMax()));
+    testHomogeneousGamma();
+    testIndividualGreeksMatchRisk();
+    return test::result();
+}
@@ -0,0 +1,134 @@
+/**
+ * @file test_portfolio.cpp
+ * @brief Portefeuille de lookbacks : résultats identiques à riskMC / priceMC, configurations
+ * refusées et type de contrat inconnu signalé par le C ABI.
+ */
+
+#include "Exports.h"
+#include "TestUtil.h"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+    const int paths = 4000, steps = 16;
+    const std::uint64_t seed = 5;
+
+    const double S0[] = { 100.0, 95.0, 100.0 };
+    const double R[] = { 0.05, 0.03, 0.05 };
+    const double sigma[] = { 0.2, 0.3, -1.0 };   // dernier contrat invalide
+    const double T0[] = { 0.0, 0.0, 0.0 };
+    const double T[] = { 1.0, 0.5, 1.0 };
+    const int type[] = { 0, 1, 0 };
+
+    opt::LookbackPortfolio makePortfolio(const int* types) {
+        opt::LookbackPortfolio portfolio;
+        portfolio.count = 3;
+        portfolio.S0 = S0;
+        portfolio.R = R;
+        portfolio.sigma = sigma;
+        portfolio.T0 = T0;
+        portfolio.T = T;
+        portfolio.type = types;
+        return portfolio;
+    }
+
+    void testMatchesRiskMC(int threads) {
+        double price[3], priceSE[3], delta[3], gamma[3], theta[3], rho[3], vega[3], vegaSE[3];
+        opt::LookbackPortfolioResults results;
+        results.price = price;
+        results.priceSE = priceSE;
+        results.delta = delta;
+        results.gamma = gamma;
+        results.theta = theta;
+        results.rho = rho;
+        results.vega = vega;
+        results.vegaSE = vegaSE;
+
+        opt::MCConfig config;
+        config.threads = threads;
+        CHECK(opt::priceLookbackPortfolio(makePortfolio(type), paths, steps, seed, true, config,
+            opt::RiskBumps(), results) == 2);
+
+        opt::Asian<opt::FloatingCallPayoff, opt::LookMin> call(S0[0], R[0], sigma[0], T0[0], T[0],
+            opt::FloatingCallPayoff(), opt::LookMin());
+        opt::Asian<opt::FloatingPutPayoff, opt::LookMax> put(S0[1], R[1], sigma[1], T0[1], T[1],
+            opt::FloatingPutPayoff(), opt::LookMax());
+        call.setConfig(config);
+        put.setConfig(config);
+        const opt::MCRisk expected[] = { call.riskMC(paths, steps, seed, true), put.riskMC(paths, steps, seed, true) };
+
+        for (int i = 0; i < 2; ++i) {
+            CHECK(price[i] == expected[i].price.estimate);
+            CHECK(priceSE[i] == expected[i].price.stdError);
+            CHECK(delta[i] == expected[i].delta.estimate);
+            CHECK(gamma[i] == expected[i].gamma.estimate);
+            CHECK(theta[i] == expected[i].theta.estimate);
+            CHECK(rho[i] == expected[i].rho.estimate);
+            CHECK(vega[i] == expected[i].vega.estimate);
+            CHECK(vegaSE[i] == expected[i].vega.stdError);
+        }
+        CHECK(std::isnan(price[2]) && std::isnan(vega[2]));
+
+        // Prix seul : priceMC du moteur scalaire
+        double priceOnly[3];
+        opt::LookbackPortfolioResults priceResults;
+        priceResults.price = priceOnly;
+        opt::priceLookbackPortfolio(makePortfolio(type), paths, steps, seed, true, config, opt::RiskBumps(), priceResults);
+        CHECK(priceOnly[0] == call.priceMC(paths, steps, seed, true).estimate);
+        CHECK(priceOnly[1] == put.priceMC(paths, steps, seed, true).estimate);
+    }
+
+    bool rejects(const opt::MCConfig& config) {
+        double price[3];
+        opt::LookbackPortfolioResults results;
+        results.price = price;
+        try {
+            opt::priceLookbackPortfolio(makePortfolio(type), paths, steps, seed, true, config, opt::RiskBumps(), results);
+        }
+        catch (const std::invalid_argument&) {
+            return true;
+        }
+        return false;
+    }
+
+    void testRejectsUnsupportedConfig() {
+        opt::MCConfig batched;
+        batched.kernel = opt::PathKernel::Batched;
+        CHECK(rejects(batched));
+
+        opt::MCConfig control;
+        control.control = opt::ControlVariate::ContinuousExtreme;
+        CHECK(rejects(control));
+
+        opt::MCConfig fused;
+        fused.fusedAntithetic = true;
+        CHECK(rejects(fused));
+    }
+
+    void testUnknownTypeReported() {
+        const int badTypes[] = { 0, 2, 1 };
+        double price[3] = { 0.0, 0.0, 0.0 };
+        opt_clear_last_error();
+        const double valued = opt_lb_portfolio_mc(3, S0, R, sigma, T0, T, badTypes, paths, steps, seed, 1, 0,
+            price, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+        CHECK(std::isnan(valued));
+        CHECK(opt_last_error_code() == OPT_ERR_INVALID_ARGUMENT);
+
+        opt_clear_last_error();
+        CHECK(opt_lb_portfolio_mc(3, S0, R, sigma, T0, T, type, paths, steps, seed, 1, 0,
+            price, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr) == 2.0);
+        CHECK(opt_last_error_code() == OPT_OK);
+    }
+
+} // namespace
+
+int main()
+{
+    testMatchesRiskMC(0);
+    testMatchesRiskMC(3);
+    testRejectsUnsupportedConfig();
+    testUnknownTypeReported();
+    return test::result();
+}
@@ -0,0 +1,92 @@
+/**
+ * @file test_result_cache.cpp
+ * @brief Cache LRU des résultats MC : succès et défauts, éviction, capacité nulle, et partage
+ * entre les exports frères (_se, _ci_low, _ci_high) d'un même calcul.
+ */
+
+#include "Exports.h"
+#include "ResultCache.h"
+#include "TestUtil.h"
+
+extern "C" OPT_API void OPT_CALL ResetResultCache();
+
+namespace {
+
+    opt::PricingKey makeKey(std::uint64_t seed) {
+        opt::PricingKey key;
+        key.S0 = 100.0;
+        key.R = 0.05;
+        key.sigma = 0.2;
+        key.T = 1.0;
+        key.paths = 1000;
+        key.steps = 10;
+        key.seed = seed;
+        return key;
+    }
+
+    opt::MCStats makeStats(double estimate) {
+        opt::MCStats stats;
+        stats.estimate = estimate;
+        return stats;
+    }
+
+    void testHitsMissesAndEviction() {
+        opt::ResultCache cache(2);
+        opt::MCStats stats;
+        CHECK(!cache.find(makeKey(1), stats));
+        cache.insert(makeKey(1), makeStats(1.0));
+        cache.insert(makeKey(2), makeStats(2.0));
+        CHECK(cache.find(makeKey(1), stats) && stats.estimate == 1.0);   // 1 devient le plus récent
+
+        // Zéros signés confondus
+        opt::PricingKey negZero = makeKey(1);
+        negZero.T0 = -0.0;
+        CHECK(cache.find(negZero, stats));
+
+        cache.insert(makeKey(3), makeStats(3.0));   // évince 2, le moins récemment utilisé
+        CHECK(cache.size() == 2);
+        CHECK(!cache.find(makeKey(2), stats));
+        CHECK(cache.find(makeKey(3), stats) && stats.estimate == 3.0);
+        CHECK(cache.hits() == 3 && cache.misses() == 2);
+
+        cache.setCapacity(0);
+        cache.insert(makeKey(4), makeStats(4.0));
+        CHECK(cache.size() == 0);
+        CHECK(!cache.find(makeKey(4), stats));
+
+        cache.clear();
+        CHECK(cache.hits() == 0 && cache.misses() == 0);
+    }
+
+    void testExportsShareSimulation() {
+        const double S0 = 100.0, R = 0.05, sigma = 0.2, T0 = 0.0, T = 1.0;
+        opt_cache_set_capacity(4096);
+        ResetResultCache();
+
+        const double price = opt_lb_call_price_mc_vr(S0, R, sigma, T0, T, 5000, 20, 7);
+        const double se = opt_lb_call_price_mc_vr_se(S0, R, sigma, T0, T, 5000, 20, 7);
+        CHECK(opt_cache_misses() == 1.0 && opt_cache_hits() == 1.0);
+        CHECK(se > 0.0);
+        CHECK_NEAR(opt_lb_call_price_mc_vr_ci_low(S0, R, sigma, T0, T, 5000, 20, 7), price - 1.96 * se, 1e-12);
+        CHECK(opt_cache_hits() == 2.0);
+
+        // Autre graine, autre grandeur : nouveaux calculs
+        CHECK(opt_lb_call_price_mc_vr(S0, R, sigma, T0, T, 5000, 20, 8) != price);
+        opt_lb_call_delta_mc_vr(S0, R, sigma, T0, T, 5000, 20, 7);
+        CHECK(opt_cache_misses() == 3.0 && opt_cache_size() == 3.0);
+
+        opt_cache_set_capacity(0);
+        CHECK(opt_cache_size() == 0.0);
+        CHECK(opt_lb_call_price_mc_vr(S0, R, sigma, T0, T, 5000, 20, 7) == price);   // recalcul identique
+        CHECK(opt_cache_misses() == 4.0);
+        opt_cache_set_capacity(4096);
+    }
+
+} // namespace
+
+int main()
+{
+    testHitsMissesAndEviction();
+    testExportsShareSimulation();
+    return test::result();
+}
@@ -0,0 +1,71 @@
+/**
+ * @file test_sobol_bridge.cpp
+ * @brief Quasi-Monte Carlo avec gaussiennes auxiliaires : le pont brownien ne porte que les
+ * incréments de la trajectoire, les uniformes de la correction de pont sont tirés à part.
+ */
+
+#include "Exports.h"
+#include "TestUtil.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+
+    void testPathIndependentOfAuxiliaryDraws() {
+        const int steps = 16, paths = 64;
+        opt::NormalGenerator plain(opt::RngKind::Sobol, 42, 0);
+        opt::NormalGenerator withAux(opt::RngKind::Sobol, 42, 0);
+        std::vector<double> Z(steps), Zaux(2 * steps);
+
+        bool samePath = true, auxFinite = true;
+        for (int i = 0; i < paths; ++i) {
+            plain.fill(Z.data(), steps);
+            withAux.fill(Zaux.data(), 2 * steps, steps);
+            for (int j = 0; j < steps; ++j) samePath = samePath && (Z[j] == Zaux[j]);
+            for (int j = steps; j < 2 * steps; ++j) auxFinite = auxFinite && std::isfinite(Zaux[j]);
+        }
+        CHECK(samePath);
+        CHECK(auxFinite);
+    }
+
+    void testBridgeCorrectionConverges() {
+        opt::Asian<opt::FloatingCallPayoff, opt::LookMin> call(100.0, 0.05, 0.2, 0.0, 1.0,
+            opt::FloatingCallPayoff(), opt::LookMin());
+        opt::MCConfig config;
+        config.rng = opt::RngKind::Sobol;
+        config.bridgeCorrection = true;
+        call.setConfig(config);
+
+        const opt::MCStats s = call.priceMC(1 << 15, 16, 3, false);
+        const double exact = opt_lb_call_price_analytic(100.0, 0.05, 0.2, 0.0, 1.0);
+        CHECK(s.stdError < 0.02);
+        CHECK_NEAR(s.estimate, exact, 4.0 * s.stdError + 1e-3);
+    }
+
+    void testContinuousControlMatchesStreams() {
+        // Contrôle continu : uniformes tirés hors du pont en Sobol, même prix qu'en Monte Carlo
+        opt::Asian<opt::FloatingPutPayoff, opt::LookMax> put(100.0, 0.05, 0.2, 0.0, 1.0,
+            opt::FloatingPutPayoff(), opt::LookMax());
+        opt::MCConfig config;
+        config.control = opt::ControlVariate::ContinuousExtreme;
+        put.setConfig(config);
+        const opt::MCStats cv = put.priceMC(20000, 16, 9, false);
+        CHECK(cv.stdError < 0.05);
+
+        config.rng = opt::RngKind::Sobol;
+        put.setConfig(config);
+        const opt::MCStats qmc = put.priceMC(1 << 14, 16, 9, false);
+        CHECK(qmc.stdError < cv.stdError);
+        CHECK_NEAR(qmc.estimate, cv.estimate, 4.0 * std::sqrt(cv.stdError * cv.stdError + qmc.stdError * qmc.stdError));
+    }
+
+} // namespace
+
+int main()
+{
+    testPathIndependentOfAuxiliaryDraws();
+    testBridgeCorrectionConverges();
+    testContinuousControlMatchesStreams();
+    return test::result();
+}
@@ -0,0 +1,56 @@
+/**
+ * @file test_threads.cpp
+ * @brief Moteur parallèle : résultats identiques au bit près quel que soit le nombre de threads
+ * (>= 1), blocs entamés compris.
+ */
+
+#include "Asian.h"
+#include "TestUtil.h"
+
+namespace {
+
+    using LookbackCall = opt::Asian<opt::FloatingCallPayoff, opt::LookMin>;
+
+    // Plusieurs blocs de kBlockSamples, le dernier entamé
+    const int paths = 3 * 4096 + 777, steps = 12;
+
+    LookbackCall makeCall(int threads) {
+        LookbackCall call(100.0, 0.05, 0.2, 0.0, 1.0, opt::FloatingCallPayoff(), opt::LookMin());
+        opt::MCConfig config;
+        config.threads = threads;
+        call.setConfig(config);
+        return call;
+    }
+
+    bool same(const opt::MCStats& a, const opt::MCStats& b) {
+        return a.estimate == b.estimate && a.stdError == b.stdError && a.ciLow == b.ciLow && a.ciHigh == b.ciHigh;
+    }
+
+    void testPriceIndependentOfThreads(bool antithetic) {
+        const opt::MCStats ref = makeCall(1).priceMC(paths, steps, 5, antithetic);
+        for (int threads = 2; threads <= 5; ++threads)
+            CHECK(same(makeCall(threads).priceMC(paths, steps, 5, antithetic), ref));
+
+        // Moteur séquentiel historique : autre flux, même prix aux erreurs Monte Carlo près
+        const opt::MCStats serial = makeCall(0).priceMC(paths, steps, 5, antithetic);
+        CHECK_NEAR(serial.estimate, ref.estimate, 5.0 * (serial.stdError + ref.stdError));
+    }
+
+    void testRiskIndependentOfThreads() {
+        const opt::MCRisk ref = makeCall(1).riskMC(paths, steps, 7, true);
+        for (int threads : { 2, 4 }) {
+            const opt::MCRisk r = makeCall(threads).riskMC(paths, steps, 7, true);
+            CHECK(same(r.price, ref.price) && same(r.delta, ref.delta) && same(r.gamma, ref.gamma));
+            CHECK(same(r.theta, ref.theta) && same(r.rho, ref.rho) && same(r.vega, ref.vega));
+        }
+    }
+
+} // namespace
+
+int main()
+{
+    testPriceIndependentOfThreads(false);
+    testPriceIndependentOfThreads(true);
+    testRiskIndependentOfThreads();
+    return test::result();
+}